@@ -250,23 +250,29 @@ end
 
 flags {"NoIncrementalLink", "NoMinimalRebuild", "MultiProcessorCompile", "No64BitChecks"}
 
-filter "platforms:x64"
+filter {"platforms:x64", "system:windows"}
 	defines {"_WINDOWS", "WIN32"}
 filter {}
 
 filter "configurations:Release"
 	optimize "Size"
-	buildoptions {"/GL"}
-	linkoptions { "/IGNORE:4702", "/LTCG" }
 	defines {"NDEBUG"}
 	flags {"FatalCompileWarnings"}
 filter {}
 
+filter {"configurations:Release", "system:windows"}
+	buildoptions {"/GL"}
+	linkoptions { "/IGNORE:4702", "/LTCG" }
+filter {}
+
 filter "configurations:Debug"
 	optimize "Debug"
 	defines {"DEBUG", "_DEBUG"}
 filter {}
 
+-- Only the demonware emulator host and the utility benchmarks build outside of Windows
+if os.istarget("windows") then
+
 project "common"
 kind "StaticLib"
 language "C++"
@@ -350,8 +356,77 @@ links {"common"}
 
 dependencies.imports()
 
+end
+
+project "dw-host"
+kind "ConsoleApp"
+language "C++"
+
+files {
+	"./src/dw-host/**.hpp", "./src/dw-host/**.cpp",
+	"./src/client/game/demonware/**.hpp", "./src/client/game/demonware/**.cpp",
+	"./src/common/utils/cryptography.cpp", "./src/common/utils/io.cpp", "./src/common/utils/memory.cpp",
+	"./src/common/utils/string.cpp", "./src/common/utils/thread.cpp",
+}
+
+includedirs {"./src/dw-host", "./src/client", "./src/common", "%{prj.location}/src"}
+
+filter "system:linux"
+	links {"pthread"}
+	disablewarnings {"unknown-pragmas"}
+filter {}
+
+libtomcrypt.import()
+libtommath.import()
+gsl.import()
+rapidjson.import()
+
+project "utils-bench"
+kind "ConsoleApp"
+language "C++"
+
+files {
+	"./src/utils-bench/**.hpp", "./src/utils-bench/**.cpp",
+	"./src/common/utils/signature.cpp", "./src/common/utils/signature_cache.cpp", "./src/common/utils/thread.cpp",
+	"./src/common/utils/string.cpp", "./src/common/utils/memory.cpp", "./src/common/utils/io.cpp",
+	"./src/common/utils/hook_transaction.cpp",
+}
+
+includedirs {"./src/utils-bench", "./src/common", "%{prj.location}/src"}
+
+filter "system:linux"
+	links {"pthread"}
+	disablewarnings {"unknown-pragmas"}
+filter {}
+
+project "dw-fuzz"
+kind "ConsoleApp"
+language "C++"
+
+files {
+	"./src/dw-fuzz/**.hpp", "./src/dw-fuzz/**.cpp",
+	"./src/client/game/demonware/byte_buffer.cpp", "./src/client/game/demonware/byte_reader.cpp",
+	"./src/client/game/demonware/byte_writer.cpp",
+}
+
+includedirs {"./src/dw-fuzz", "./src/client", "./src/common", "%{prj.location}/src"}
+
+-- Without the fuzzer the target replays inputs or runs random ones
+filter "system:linux"
+	toolset "clang"
+	defines {"LIBFUZZER"}
+	buildoptions {"-fsanitize=fuzzer,address,undefined"}
+	linkoptions {"-fsanitize=fuzzer,address,undefined"}
+	disablewarnings {"unknown-pragmas"}
+filter {}
+
 group "Dependencies"
-dependencies.projects()
+if os.istarget("windows") then
+	dependencies.projects()
+else
+	libtomcrypt.project()
+	libtommath.project()
+end
 
 rule "ProtobufCompiler"
 display "Protobuf compiler"
@@ -208,78 +208,87 @@ namespace dedicated
 			// patch GScr_SetDynamicDvar to behave better
 			gscr_set_dynamic_dvar_hook.create(0x140312D00, &gscr_set_dynamic_dvar);
 
-			utils::hook::nop(0x1404AE6AE, 5); // don't load config file
-			utils::hook::nop(0x1403AF719, 5); // ^
-			utils::hook::set<uint8_t>(0x1403D2490, 0xC3); // don't save config file
-			utils::hook::set<uint8_t>(0x14022AFC0, 0xC3); // disable self-registration
-			utils::hook::set<uint8_t>(0x1404DA780, 0xC3); // init sound system (1)
-			utils::hook::set<uint8_t>(0x14062BC10, 0xC3); // init sound system (2)
-			utils::hook::set<uint8_t>(0x1405F31A0, 0xC3); // render thread
-			utils::hook::set<uint8_t>(0x140213C20, 0xC3); // called from Com_Frame, seems to do renderer stuff
-			utils::hook::set<uint8_t>(0x1402085C0, 0xC3);
+			// Applied together, so each page is unprotected only once
+			utils::hook::transaction patches;
+
+			patches.nop(0x1404AE6AE, 5); // don't load config file
+			patches.nop(0x1403AF719, 5); // ^
+			patches.set<uint8_t>(0x1403D2490, 0xC3); // don't save config file
+			patches.set<uint8_t>(0x14022AFC0, 0xC3); // disable self-registration
+			patches.set<uint8_t>(0x1404DA780, 0xC3); // init sound system (1)
+			patches.set<uint8_t>(0x14062BC10, 0xC3); // init sound system (2)
+			patches.set<uint8_t>(0x1405F31A0, 0xC3); // render thread
+			patches.set<uint8_t>(0x140213C20, 0xC3); // called from Com_Frame, seems to do renderer stuff
+			patches.set<uint8_t>(0x1402085C0, 0xC3);
 			// CL_CheckForResend, which tries to connect to the local server constantly
-			utils::hook::set<uint8_t>(0x14059B854, 0); // r_loadForRenderer default to 0
-			utils::hook::set<uint8_t>(0x1404D6952, 0xC3); // recommended settings check - TODO: Check hook
-			utils::hook::set<uint8_t>(0x1404D9BA0, 0xC3); // some mixer-related function called on shutdown
-			utils::hook::set<uint8_t>(0x1403B2860, 0xC3); // dont load ui gametype stuff
-			utils::hook::nop(0x14043ABB8, 6); // unknown check in SV_ExecuteClientMessage
-			utils::hook::nop(0x140439F15, 4); // allow first slot to be occupied
-			utils::hook::nop(0x14020E01C, 2); // properly shut down dedicated servers
-			utils::hook::nop(0x14020DFE9, 2); // ^
-			utils::hook::nop(0x14020E047, 5); // don't shutdown renderer
-
-			utils::hook::set<uint8_t>(0x140057D40, 0xC3); // something to do with blendShapeVertsView
-			utils::hook::nop(0x14062EA17, 8); // sound thing
-
-			utils::hook::set<uint8_t>(0x1404D6960, 0xC3); // cpu detection stuff?
-			utils::hook::set<uint8_t>(0x1405AEC00, 0xC3); // gfx stuff during fastfile loading
-			utils::hook::set<uint8_t>(0x1405AEB10, 0xC3); // ^
-			utils::hook::set<uint8_t>(0x1405AEBA0, 0xC3); // ^
-			utils::hook::set<uint8_t>(0x140275640, 0xC3); // ^
-			utils::hook::set<uint8_t>(0x1405AEB60, 0xC3); // ^
-			utils::hook::set<uint8_t>(0x140572640, 0xC3); // directx stuff
-			utils::hook::set<uint8_t>(0x1405A1340, 0xC3); // ^
-			utils::hook::set<uint8_t>(0x140021D60, 0xC3); // ^ - mutex
-			utils::hook::set<uint8_t>(0x1405A17E0, 0xC3); // ^
-
-			utils::hook::set<uint8_t>(0x1400534F0, 0xC3); // rendering stuff
-			utils::hook::set<uint8_t>(0x1405A1AB0, 0xC3); // ^
-			utils::hook::set<uint8_t>(0x1405A1BB0, 0xC3); // ^
-			utils::hook::set<uint8_t>(0x1405A21F0, 0xC3); // ^
-			utils::hook::set<uint8_t>(0x1405A2D60, 0xC3); // ^
-			utils::hook::set<uint8_t>(0x1405A3400, 0xC3); // ^
+			patches.set<uint8_t>(0x14059B854, 0); // r_loadForRenderer default to 0
+			patches.set<uint8_t>(0x1404D6952, 0xC3); // recommended settings check - TODO: Check hook
+			patches.set<uint8_t>(0x1404D9BA0, 0xC3); // some mixer-related function called on shutdown
+			patches.set<uint8_t>(0x1403B2860, 0xC3); // dont load ui gametype stuff
+			patches.nop(0x14043ABB8, 6); // unknown check in SV_ExecuteClientMessage
+			patches.nop(0x140439F15, 4); // allow first slot to be occupied
+			patches.nop(0x14020E01C, 2); // properly shut down dedicated servers
+			patches.nop(0x14020DFE9, 2); // ^
+			patches.nop(0x14020E047, 5); // don't shutdown renderer
+
+			patches.set<uint8_t>(0x140057D40, 0xC3); // something to do with blendShapeVertsView
+			patches.nop(0x14062EA17, 8); // sound thing
+
+			patches.set<uint8_t>(0x1404D6960, 0xC3); // cpu detection stuff?
+			patches.set<uint8_t>(0x1405AEC00, 0xC3); // gfx stuff during fastfile loading
+			patches.set<uint8_t>(0x1405AEB10, 0xC3); // ^
+			patches.set<uint8_t>(0x1405AEBA0, 0xC3); // ^
+			patches.set<uint8_t>(0x140275640, 0xC3); // ^
+			patches.set<uint8_t>(0x1405AEB60, 0xC3); // ^
+			patches.set<uint8_t>(0x140572640, 0xC3); // directx stuff
+			patches.set<uint8_t>(0x1405A1340, 0xC3); // ^
+			patches.set<uint8_t>(0x140021D60, 0xC3); // ^ - mutex
+			patches.set<uint8_t>(0x1405A17E0, 0xC3); // ^
+
+			patches.set<uint8_t>(0x1400534F0, 0xC3); // rendering stuff
+			patches.set<uint8_t>(0x1405A1AB0, 0xC3); // ^
+			patches.set<uint8_t>(0x1405A1BB0, 0xC3); // ^
+			patches.set<uint8_t>(0x1405A21F0, 0xC3); // ^
+			patches.set<uint8_t>(0x1405A2D60, 0xC3); // ^
+			patches.set<uint8_t>(0x1405A3400, 0xC3); // ^
 
 			// shaders
-			utils::hook::set<uint8_t>(0x140057BC0, 0xC3); // ^
-			utils::hook::set<uint8_t>(0x140057B40, 0xC3); // ^
+			patches.set<uint8_t>(0x140057BC0, 0xC3); // ^
+			patches.set<uint8_t>(0x140057B40, 0xC3); // ^
 
-			utils::hook::set<uint8_t>(0x1405EE040, 0xC3); // ^ - mutex
+			patches.set<uint8_t>(0x1405EE040, 0xC3); // ^ - mutex
 
-			utils::hook::set<uint8_t>(0x1404DAF30, 0xC3); // idk
-			utils::hook::set<uint8_t>(0x1405736B0, 0xC3); // ^
+			patches.set<uint8_t>(0x1404DAF30, 0xC3); // idk
+			patches.set<uint8_t>(0x1405736B0, 0xC3); // ^
 
-			utils::hook::set<uint8_t>(0x1405A6E70, 0xC3); // R_Shutdown
-			utils::hook::set<uint8_t>(0x1405732D0, 0xC3); // shutdown stuff
-			utils::hook::set<uint8_t>(0x1405A6F40, 0xC3); // ^
-			utils::hook::set<uint8_t>(0x1405A61A0, 0xC3); // ^
+			patches.set<uint8_t>(0x1405A6E70, 0xC3); // R_Shutdown
+			patches.set<uint8_t>(0x1405732D0, 0xC3); // shutdown stuff
+			patches.set<uint8_t>(0x1405A6F40, 0xC3); // ^
+			patches.set<uint8_t>(0x1405A61A0, 0xC3); // ^
 
-			utils::hook::set<uint8_t>(0x14062C550, 0xC3); // sound crashes
+			patches.set<uint8_t>(0x14062C550, 0xC3); // sound crashes
 
-			utils::hook::set<uint8_t>(0x140445070, 0xC3); // disable host migration
+			patches.set<uint8_t>(0x140445070, 0xC3); // disable host migration
 
-			utils::hook::set<uint8_t>(0x1403E1A50, 0xC3); // render synchronization lock
-			utils::hook::set<uint8_t>(0x1403E1990, 0xC3); // render synchronization unlock
+			patches.set<uint8_t>(0x1403E1A50, 0xC3); // render synchronization lock
+			patches.set<uint8_t>(0x1403E1990, 0xC3); // render synchronization unlock
 
-			utils::hook::set<uint8_t>(0x1400E517B, 0xEB);
+			patches.set<uint8_t>(0x1400E517B, 0xEB);
 			// LUI: Unable to start the LUI system due to errors in main.lua
 
-			utils::hook::nop(0x1404CC482, 5); // Disable sound pak file loading
-			utils::hook::nop(0x1404CC471, 2); // ^
-			utils::hook::set<uint8_t>(0x140279B80, 0xC3); // Disable image pak file loading
+			patches.nop(0x1404CC482, 5); // Disable sound pak file loading
+			patches.nop(0x1404CC471, 2); // ^
+			patches.set<uint8_t>(0x140279B80, 0xC3); // Disable image pak file loading
 
 			// Reduce min required memory
-			utils::hook::set<uint64_t>(0x1404D140D, 0x80000000);
-			utils::hook::set<uint64_t>(0x1404D14BF, 0x80000000);
+			patches.set<uint64_t>(0x1404D140D, 0x80000000);
+			patches.set<uint64_t>(0x1404D14BF, 0x80000000);
+
+			// Running with the renderer, sound and config saving still enabled is worse than not starting
+			if (!patches.commit())
+			{
+				throw std::runtime_error("Failed to apply the dedicated server patches");
+			}
 
 			// initialize the game after onlinedataflags is 32 (workaround)
 			scheduler::schedule([=]()
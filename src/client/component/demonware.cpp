@@ -2,26 +2,47 @@
 #include "loader/component_loader.hpp"
 
 #include <utils/hook.hpp>
+#include <utils/nt.hpp>
 #include <utils/thread.hpp>
 
 #include "game/game.hpp"
+#include "command.hpp"
+#include "console.hpp"
+#include "motd.hpp"
 #include "game/demonware/servers/lobby_server.hpp"
 #include "game/demonware/servers/auth3_server.hpp"
 #include "game/demonware/servers/stun_server.hpp"
 #include "game/demonware/servers/umbrella_server.hpp"
 #include "game/demonware/server_registry.hpp"
+#include "game/demonware/user_storage.hpp"
+#include "game/demonware/trace.hpp"
+#include "game/demonware/platform.hpp"
 
 #define TCP_BLOCKING true
 #define UDP_BLOCKING false
 
 namespace demonware
 {
+	namespace platform
+	{
+		std::string load_resource(const int id)
+		{
+			return utils::nt::load_resource(id);
+		}
+
+		std::string get_motd()
+		{
+			return motd::get_text();
+		}
+	}
+
 	namespace
 	{
 		volatile bool exit_server;
 		std::thread server_thread;
 		utils::concurrency::container<std::unordered_map<SOCKET, bool>> blocking_sockets;
 		utils::concurrency::container<std::unordered_map<SOCKET, tcp_server*>> socket_map;
+		utils::concurrency::container<std::unordered_map<SOCKET, std::vector<udp_server*>>> udp_socket_map;
 		server_registry<tcp_server> tcp_servers;
 		server_registry<udp_server> udp_servers;
 
@@ -65,6 +86,24 @@ namespace demonware
 					map.erase(entry);
 				}
 			});
+
+			udp_socket_map.access([&](std::unordered_map<SOCKET, std::vector<udp_server*>>& map)
+			{
+				map.erase(socket);
+			});
+		}
+
+		// Remembers which servers a socket talked to, so recvfrom only polls those
+		void udp_socket_link(const SOCKET socket, udp_server* server)
+		{
+			udp_socket_map.access([&](std::unordered_map<SOCKET, std::vector<udp_server*>>& map)
+			{
+				auto& servers = map[socket];
+				if (std::find(servers.begin(), servers.end(), server) == servers.end())
+				{
+					servers.push_back(server);
+				}
+			});
 		}
 
 		bool is_socket_blocking(const SOCKET socket, const bool def)
@@ -212,6 +251,7 @@ namespace demonware
 
 				if (server)
 				{
+					udp_socket_link(s, server);
 					server->handle_input(buf, len, {s, to, tolen});
 					return len;
 				}
@@ -228,15 +268,25 @@ namespace demonware
 					return recvfrom(s, buf, len, flags, from, fromlen);
 				}
 
-				size_t result = 0;
-				udp_servers.for_each([&](udp_server& server)
-				{
-					if (server.pending_data(s))
+				const auto result = udp_socket_map.access<size_t>(
+					[&](const std::unordered_map<SOCKET, std::vector<udp_server*>>& map) -> size_t
 					{
-						result = server.handle_output(
-							s, buf, static_cast<size_t>(len), from, fromlen);
-					}
-				});
+						const auto entry = map.find(s);
+						if (entry == map.end())
+						{
+							return 0;
+						}
+
+						for (auto* server : entry->second)
+						{
+							if (server->pending_data(s))
+							{
+								return server->handle_output(s, buf, static_cast<size_t>(len), from, fromlen);
+							}
+						}
+
+						return 0;
+					});
 
 				if (result)
 				{
@@ -413,6 +463,44 @@ namespace demonware
 		{
 			utils::hook::jump(SELECT_VALUE(0x140575880, 0x1406C0080), bd_logger_stub);
 
+			command::add("dw_trace_start", [](const command::params& params)
+			{
+				const std::string path = params.size() > 1 ? params.get(1) : "";
+				if (!trace::start(path))
+				{
+					console::error("Failed to open trace file %s\n", path.data());
+					return;
+				}
+
+				if (path.empty())
+				{
+					console::info("Timing demonware service calls\n");
+				}
+				else
+				{
+					console::info("Timing and recording demonware service calls to %s\n", path.data());
+				}
+			});
+
+			command::add("dw_trace_stop", []()
+			{
+				trace::stop();
+				console::info("Stopped timing demonware service calls\n");
+			});
+
+			command::add("dw_trace_stats", []()
+			{
+				for (const auto& line : trace::format_histograms())
+				{
+					console::info("%s\n", line.data());
+				}
+			});
+
+			command::add("dw_trace_reset", []()
+			{
+				trace::reset_histograms();
+			});
+
 			if (game::environment::is_sp())
 			{
 				utils::hook::set<uint8_t>(0x1405632E0, 0xC3); // bdAuthSteam
@@ -440,6 +528,9 @@ namespace demonware
 			{
 				server_thread.join();
 			}
+
+			trace::stop();
+			user_storage::shutdown();
 		}
 	};
 }
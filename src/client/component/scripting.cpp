@@ -10,6 +10,8 @@
 #include "game/scripting/lua/engine.hpp"
 #include "game/scripting/execution.hpp"
 
+#include "command.hpp"
+#include "console.hpp"
 #include "scheduler.hpp"
 #include "scripting.hpp"
 
@@ -31,7 +33,7 @@ namespace scripting
 		void vm_notify_stub(const unsigned int notify_list_owner_id, const game::scr_string_t string_value,
 		                    game::VariableValue* top)
 		{
-			if (!game::VirtualLobby_Loaded())
+			if (lua::engine::has_notify_listeners(string_value) && !game::VirtualLobby_Loaded())
 			{
 				const auto* string = game::SL_ConvertToString(string_value);
 				if (string)
@@ -63,12 +65,16 @@ namespace scripting
 			if (!game::VirtualLobby_Loaded())
 			{
 				lua::engine::start();
+
+				// Custom fields of reconnecting players are reset on this one
+				lua::engine::register_notify("connected");
 			}
 		}
 
 		void g_shutdown_game_stub(const int free_scripts)
 		{
 			lua::engine::stop();
+			scripting::clear_field_id_cache();
 			return g_shutdown_game_hook.invoke<void>(free_scripts);
 		}
 
@@ -112,6 +118,57 @@ namespace scripting
 			{
 				lua::engine::run_frame();
 			}, scheduler::pipeline::server);
+
+			// Scripts only run on the server thread, so the profile is read there too
+			command::add("lua_profile_start", [](const command::params& params)
+			{
+				const auto interval = params.size() > 1 ? std::max(atoi(params.get(1)), 1) : 1000;
+				scheduler::once([interval]()
+				{
+					lua::engine::start_profiling(interval);
+					console::info("Profiling Lua scripts, sampling every %d instructions\n", interval);
+				}, scheduler::pipeline::server);
+			});
+
+			command::add("lua_profile_stop", []()
+			{
+				scheduler::once([]()
+				{
+					lua::engine::stop_profiling();
+					console::info("Stopped profiling Lua scripts\n");
+				}, scheduler::pipeline::server);
+			});
+
+			command::add("lua_profile_report", [](const command::params& params)
+			{
+				const std::string filter = params.size() > 1 ? params.get(1) : "";
+				scheduler::once([filter]()
+				{
+					lua::engine::print_profile(filter);
+				}, scheduler::pipeline::server);
+			});
+
+			command::add("lua_profile_export", [](const command::params& params)
+			{
+				if (params.size() < 2)
+				{
+					console::info("usage: lua_profile_export <file>\n");
+					return;
+				}
+
+				const std::string file = params.get(1);
+				scheduler::once([file]()
+				{
+					if (lua::engine::export_profile(file))
+					{
+						console::info("Wrote folded Lua stacks to %s\n", file.data());
+					}
+					else
+					{
+						console::error("Failed to write %s\n", file.data());
+					}
+				}, scheduler::pipeline::server);
+			});
 		}
 	};
 }
@@ -96,31 +96,38 @@ namespace demonware
 		if (bits == 0) return false;
 		if ((this->current_bit_ + bits) > (this->buffer_.size() * 8)) return false;
 
-		int cur_byte = this->current_bit_ >> 3;
-		auto cur_out = 0;
+		const auto* bytes = reinterpret_cast<const uint8_t*>(this->buffer_.data());
+		auto* output_bytes = static_cast<uint8_t*>(output);
 
-		const char* bytes = this->buffer_.data();
-		const auto output_bytes = static_cast<unsigned char*>(output);
+		const auto shift = this->current_bit_ & 7;
+		auto cur_byte = this->current_bit_ >> 3;
+		this->current_bit_ += bits;
 
-		while (bits > 0)
+		if (shift == 0)
 		{
-			const int min_bit = (bits < 8) ? bits : 8;
-			const auto this_byte = bytes[cur_byte++] & 0xFF;
-			const int remain = this->current_bit_ & 7;
+			const auto whole_bytes = bits >> 3;
+			std::memcpy(output_bytes, bytes + cur_byte, whole_bytes);
 
-			if ((min_bit + remain) <= 8)
-			{
-				output_bytes[cur_out] = BYTE((0xFF >> (8 - min_bit)) & (this_byte >> remain));
-			}
-			else
+			if (bits & 7)
 			{
-				output_bytes[cur_out] = BYTE(
-					(0xFF >> (8 - min_bit)) & (bytes[cur_byte] << (8 - remain)) | (this_byte >> remain));
+				output_bytes[whole_bytes] = uint8_t(bytes[cur_byte + whole_bytes] & (0xFF >> (8 - (bits & 7))));
 			}
 
-			cur_out++;
-			this->current_bit_ += min_bit;
-			bits -= min_bit;
+			return true;
+		}
+
+		const auto available = this->buffer_.size();
+
+		while (bits > 0)
+		{
+			const auto chunk = std::min(bits, 56u);
+			const auto value = load_bits(bytes + cur_byte, std::min(size_t(8), available - cur_byte)) >> shift;
+
+			store_bits(output_bytes, value & (~0ull >> (64 - chunk)), (chunk + 7) >> 3);
+
+			output_bytes += 7;
+			cur_byte += 7;
+			bits -= chunk;
 		}
 
 		return true;
@@ -129,41 +136,67 @@ namespace demonware
 	bool bit_buffer::write(const unsigned int bits, const void* data)
 	{
 		if (bits == 0) return false;
-		this->buffer_.resize(this->buffer_.size() + (bits >> 3) + 1);
-
-		int bit = bits;
-		const auto bytes = const_cast<char*>(this->buffer_.data());
-		const auto* input_bytes = static_cast<const unsigned char*>(data);
 
-		while (bit > 0)
+		const size_t required = (this->current_bit_ + bits + 7) >> 3;
+		if (this->buffer_.size() < required)
 		{
-			const int bit_pos = this->current_bit_ & 7;
-			auto rem_bit = 8 - bit_pos;
-			const auto this_write = (bit < rem_bit) ? bit : rem_bit;
-
-			const BYTE mask = ((0xFF >> rem_bit) | (0xFF << (bit_pos + this_write)));
-			const int byte_pos = this->current_bit_ >> 3;
+			this->buffer_.resize(required);
+		}
 
-			const BYTE temp_byte = (mask & bytes[byte_pos]);
-			const BYTE this_bit = ((bits - bit) & 7);
-			const auto this_byte = (bits - bit) >> 3;
+		auto* bytes = reinterpret_cast<uint8_t*>(this->buffer_.data());
+		const auto* input_bytes = static_cast<const uint8_t*>(data);
 
-			auto this_data = input_bytes[this_byte];
+		const auto shift = this->current_bit_ & 7;
+		auto cur_byte = this->current_bit_ >> 3;
+		this->current_bit_ += bits;
 
-			const auto next_byte = (((bits - 1) >> 3) > this_byte) ? input_bytes[this_byte + 1] : 0;
+		if (shift == 0)
+		{
+			const auto whole_bytes = bits >> 3;
+			std::memcpy(bytes + cur_byte, input_bytes, whole_bytes);
 
-			this_data = BYTE((next_byte << (8 - this_bit)) | (this_data >> this_bit));
+			if (bits & 7)
+			{
+				const auto mask = uint8_t(0xFF >> (8 - (bits & 7)));
+				auto& target = bytes[cur_byte + whole_bytes];
+				target = uint8_t((target & ~mask) | (input_bytes[whole_bytes] & mask));
+			}
 
-			const BYTE out_byte = (~mask & (this_data << bit_pos) | temp_byte);
-			bytes[byte_pos] = out_byte;
+			return true;
+		}
 
-			this->current_bit_ += this_write;
-			bit -= this_write;
+		auto remaining = bits;
+		while (remaining > 0)
+		{
+			const auto chunk = std::min(remaining, 56u);
+			const auto mask = ~0ull >> (64 - chunk);
+			const auto value = load_bits(input_bytes, (chunk + 7) >> 3) & mask;
+
+			const auto span = (shift + chunk + 7) >> 3;
+			auto target = load_bits(bytes + cur_byte, span);
+			target = (target & ~(mask << shift)) | (value << shift);
+			store_bits(bytes + cur_byte, target, span);
+
+			input_bytes += 7;
+			cur_byte += 7;
+			remaining -= chunk;
 		}
 
 		return true;
 	}
 
+	uint64_t bit_buffer::load_bits(const uint8_t* data, const size_t bytes)
+	{
+		uint64_t value = 0;
+		std::memcpy(&value, data, bytes);
+		return value;
+	}
+
+	void bit_buffer::store_bits(uint8_t* data, const uint64_t value, const size_t bytes)
+	{
+		std::memcpy(data, &value, bytes);
+	}
+
 	void bit_buffer::set_use_data_types(const bool use_data_types)
 	{
 		this->use_data_types_ = use_data_types;
@@ -36,5 +36,9 @@ namespace demonware
 		std::string buffer_{};
 		unsigned int current_bit_ = 0;
 		bool use_data_types_ = true;
+
+		// Little-endian partial loads/stores backing the 64-bit accumulator
+		static uint64_t load_bits(const uint8_t* data, size_t bytes);
+		static void store_bits(uint8_t* data, uint64_t value, size_t bytes);
 	};
 }
@@ -39,13 +39,13 @@ namespace demonware
 		return this->read(4, output);
 	}
 
-	bool byte_buffer::read_int64(__int64* output)
+	bool byte_buffer::read_int64(int64_t* output)
 	{
 		if (!this->read_data_type(9)) return false;
 		return this->read(8, output);
 	}
 
-	bool byte_buffer::read_uint64(unsigned __int64* output)
+	bool byte_buffer::read_uint64(uint64_t* output)
 	{
 		if (!this->read_data_type(10)) return false;
 		return this->read(8, output);
@@ -74,8 +74,11 @@ namespace demonware
 	{
 		if (!this->read_data_type(16)) return false;
 
+		const auto end = std::string_view(this->buffer_).substr(this->current_byte_).find('\0');
+		if (end == std::string_view::npos) return false;
+
 		*output = const_cast<char*>(this->buffer_.data()) + this->current_byte_;
-		this->current_byte_ += strlen(*output) + 1;
+		this->current_byte_ += end + 1;
 
 		return true;
 	}
@@ -84,8 +87,12 @@ namespace demonware
 	{
 		if (!this->read_data_type(16)) return false;
 
-		strcpy_s(output, length, const_cast<char*>(this->buffer_.data()) + this->current_byte_);
-		this->current_byte_ += strlen(output) + 1;
+		const auto input = std::string_view(this->buffer_).substr(this->current_byte_);
+		const auto end = input.find('\0');
+		if (end == std::string_view::npos || end >= static_cast<size_t>(length)) return false;
+
+		std::memcpy(output, input.data(), end + 1);
+		this->current_byte_ += end + 1;
 
 		return true;
 	}
@@ -112,7 +119,10 @@ namespace demonware
 		}
 
 		unsigned int size;
-		this->read_uint32(&size);
+		if (!this->read_uint32(&size) || size > this->buffer_.size() - this->current_byte_)
+		{
+			return false;
+		}
 
 		*output = const_cast<char*>(this->buffer_.data()) + this->current_byte_;
 		*length = static_cast<int>(size);
@@ -127,8 +137,7 @@ namespace demonware
 		if (!this->use_data_types_) return true;
 
 		char type;
-		this->read(1, &type);
-		return type == expected;
+		return this->read(1, &type) && type == expected;
 	}
 
 	bool byte_buffer::read_array_header(const unsigned char expected, unsigned int* element_count,
@@ -143,11 +152,13 @@ namespace demonware
 		if (!this->read_uint32(&array_size)) return false;
 
 		this->set_use_data_types(false);
-		this->read_uint32(&el_count);
+		const auto result = this->read_uint32(&el_count);
 		this->set_use_data_types(true);
 
+		if (!result) return false;
+
 		if (element_count) *element_count = el_count;
-		if (element_size) *element_size = array_size / el_count;
+		if (element_size) *element_size = el_count ? array_size / el_count : 0;
 
 		return true;
 	}
@@ -188,13 +199,13 @@ namespace demonware
 		return this->write(4, &data);
 	}
 
-	bool byte_buffer::write_int64(__int64 data)
+	bool byte_buffer::write_int64(int64_t data)
 	{
 		this->write_data_type(9);
 		return this->write(8, &data);
 	}
 
-	bool byte_buffer::write_uint64(unsigned __int64 data)
+	bool byte_buffer::write_uint64(uint64_t data)
 	{
 		this->write_data_type(10);
 		return this->write(8, &data);
@@ -225,7 +236,7 @@ namespace demonware
 
 	bool byte_buffer::write_blob(const std::string& data)
 	{
-		return this->write_blob(data.data(), INT(data.size()));
+		return this->write_blob(data.data(), static_cast<int>(data.size()));
 	}
 
 	bool byte_buffer::write_blob(const char* data, const int length)
@@ -17,8 +17,8 @@ namespace demonware
 		bool read_uint16(unsigned short* output);
 		bool read_int32(int* output);
 		bool read_uint32(unsigned int* output);
-		bool read_int64(__int64* output);
-		bool read_uint64(unsigned __int64* output);
+		bool read_int64(int64_t* output);
+		bool read_uint64(uint64_t* output);
 		bool read_float(float* output);
 		bool read_string(char** output);
 		bool read_string(char* output, int length);
@@ -36,8 +36,8 @@ namespace demonware
 		bool write_uint16(unsigned short data);
 		bool write_int32(int data);
 		bool write_uint32(unsigned int data);
-		bool write_int64(__int64 data);
-		bool write_uint64(unsigned __int64 data);
+		bool write_int64(int64_t data);
+		bool write_uint64(uint64_t data);
 		bool write_data_type(char data);
 		bool write_float(float data);
 		bool write_string(const char* data);
@@ -0,0 +1,199 @@
+#include <std_include.hpp>
+#include "byte_reader.hpp"
+
+namespace demonware
+{
+	bool byte_reader::read_byte(unsigned char* output)
+	{
+		return this->read_typed(3, 1, output);
+	}
+
+	bool byte_reader::read_bool(bool* output)
+	{
+		unsigned char value;
+		if (!this->read_typed(1, 1, &value)) return false;
+
+		*output = value != 0;
+		return true;
+	}
+
+	bool byte_reader::read_int16(short* output)
+	{
+		return this->read_typed(5, 2, output);
+	}
+
+	bool byte_reader::read_uint16(unsigned short* output)
+	{
+		return this->read_typed(6, 2, output);
+	}
+
+	bool byte_reader::read_int32(int* output)
+	{
+		return this->read_typed(7, 4, output);
+	}
+
+	bool byte_reader::read_uint32(unsigned int* output)
+	{
+		return this->read_typed(8, 4, output);
+	}
+
+	bool byte_reader::read_int64(int64_t* output)
+	{
+		return this->read_typed(9, 8, output);
+	}
+
+	bool byte_reader::read_uint64(uint64_t* output)
+	{
+		return this->read_typed(10, 8, output);
+	}
+
+	bool byte_reader::read_float(float* output)
+	{
+		return this->read_typed(13, 4, output);
+	}
+
+	bool byte_reader::read_string(std::string_view* output)
+	{
+		const auto start = this->current_byte_;
+		if (!this->read_data_type(16)) return false;
+
+		const auto remaining = this->get_remaining();
+		const auto end = remaining.find('\0');
+		if (end == std::string_view::npos)
+		{
+			this->current_byte_ = start;
+			return false;
+		}
+
+		*output = remaining.substr(0, end);
+		this->current_byte_ += end + 1;
+
+		return true;
+	}
+
+	bool byte_reader::read_blob(std::string_view* output)
+	{
+		const auto start = this->current_byte_;
+
+		unsigned int size;
+		if (!this->read_data_type(0x13) || !this->read_uint32(&size) || !this->read_view(size, output))
+		{
+			this->current_byte_ = start;
+			return false;
+		}
+
+		return true;
+	}
+
+	bool byte_reader::read_data_type(const char expected)
+	{
+		if (!this->use_data_types_) return true;
+		if (!this->remaining()) return false;
+
+		if (static_cast<char>(this->data_[this->current_byte_]) != expected) return false;
+
+		++this->current_byte_;
+		return true;
+	}
+
+	bool byte_reader::read_array_header(const unsigned char expected, unsigned int* element_count,
+	                                    unsigned int* element_size)
+	{
+		const auto start = this->current_byte_;
+		const auto using_types = this->use_data_types_;
+
+		uint32_t array_size, el_count;
+		if (!this->read_data_type(static_cast<char>(expected + 100)) || !this->read_uint32(&array_size))
+		{
+			this->current_byte_ = start;
+			return false;
+		}
+
+		this->use_data_types_ = false;
+		const auto result = this->read_uint32(&el_count);
+		this->use_data_types_ = using_types;
+
+		if (!result)
+		{
+			this->current_byte_ = start;
+			return false;
+		}
+
+		if (element_count) *element_count = el_count;
+		if (element_size) *element_size = el_count ? array_size / el_count : 0;
+
+		return true;
+	}
+
+	bool byte_reader::read(const size_t bytes, void* output)
+	{
+		if (bytes > this->remaining()) return false;
+
+		std::memcpy(output, this->data_.data() + this->current_byte_, bytes);
+		this->current_byte_ += bytes;
+
+		return true;
+	}
+
+	bool byte_reader::read_view(const size_t bytes, std::string_view* output)
+	{
+		if (bytes > this->remaining()) return false;
+
+		*output = this->get_remaining().substr(0, bytes);
+		this->current_byte_ += bytes;
+
+		return true;
+	}
+
+	bool byte_reader::skip(const size_t bytes)
+	{
+		if (bytes > this->remaining()) return false;
+
+		this->current_byte_ += bytes;
+		return true;
+	}
+
+	void byte_reader::set_use_data_types(const bool use_data_types)
+	{
+		this->use_data_types_ = use_data_types;
+	}
+
+	bool byte_reader::is_using_data_types() const
+	{
+		return this->use_data_types_;
+	}
+
+	size_t byte_reader::size() const
+	{
+		return this->data_.size();
+	}
+
+	size_t byte_reader::offset() const
+	{
+		return this->current_byte_;
+	}
+
+	size_t byte_reader::remaining() const
+	{
+		return this->data_.size() - this->current_byte_;
+	}
+
+	bool byte_reader::has_more_data() const
+	{
+		return this->remaining() > 0;
+	}
+
+	std::string_view byte_reader::get_remaining() const
+	{
+		return {reinterpret_cast<const char*>(this->data_.data()) + this->current_byte_, this->remaining()};
+	}
+
+	bool byte_reader::read_typed(const char type, const size_t bytes, void* output)
+	{
+		const size_t header = this->use_data_types_ ? 1 : 0;
+		if (header + bytes > this->remaining()) return false;
+
+		if (!this->read_data_type(type)) return false;
+		return this->read(bytes, output);
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+namespace demonware
+{
+	// Non-owning, bounds-checked counterpart to byte_buffer for parsing.
+	// Failed reads never advance the cursor or touch the output.
+	class byte_reader final
+	{
+	public:
+		byte_reader() = default;
+
+		explicit byte_reader(const std::span<const std::byte> data) : data_(data)
+		{
+		}
+
+		explicit byte_reader(const std::string_view data)
+			: data_(reinterpret_cast<const std::byte*>(data.data()), data.size())
+		{
+		}
+
+		bool read_byte(unsigned char* output);
+		bool read_bool(bool* output);
+		bool read_int16(short* output);
+		bool read_uint16(unsigned short* output);
+		bool read_int32(int* output);
+		bool read_uint32(unsigned int* output);
+		bool read_int64(int64_t* output);
+		bool read_uint64(uint64_t* output);
+		bool read_float(float* output);
+		bool read_string(std::string_view* output);
+		bool read_blob(std::string_view* output);
+		bool read_data_type(char expected);
+
+		bool read_array_header(unsigned char expected, unsigned int* element_count,
+		                       unsigned int* element_size = nullptr);
+
+		bool read(size_t bytes, void* output);
+		bool read_view(size_t bytes, std::string_view* output);
+		bool skip(size_t bytes);
+
+		void set_use_data_types(bool use_data_types);
+		bool is_using_data_types() const;
+
+		size_t size() const;
+		size_t offset() const;
+		size_t remaining() const;
+		bool has_more_data() const;
+
+		std::string_view get_remaining() const;
+
+	private:
+		std::span<const std::byte> data_{};
+		size_t current_byte_ = 0;
+		bool use_data_types_ = true;
+
+		bool read_typed(char type, size_t bytes, void* output);
+	};
+}
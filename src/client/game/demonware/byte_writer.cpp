@@ -0,0 +1,124 @@
+#include <std_include.hpp>
+#include "byte_writer.hpp"
+
+namespace demonware
+{
+	bool byte_writer::write_byte(const char data)
+	{
+		this->write_data_type(3);
+		return this->write(1, &data);
+	}
+
+	bool byte_writer::write_bool(const bool data)
+	{
+		this->write_data_type(1);
+		return this->write(1, &data);
+	}
+
+	bool byte_writer::write_int16(const short data)
+	{
+		this->write_data_type(5);
+		return this->write(2, &data);
+	}
+
+	bool byte_writer::write_uint16(const unsigned short data)
+	{
+		this->write_data_type(6);
+		return this->write(2, &data);
+	}
+
+	bool byte_writer::write_int32(const int data)
+	{
+		this->write_data_type(7);
+		return this->write(4, &data);
+	}
+
+	bool byte_writer::write_uint32(const unsigned int data)
+	{
+		this->write_data_type(8);
+		return this->write(4, &data);
+	}
+
+	bool byte_writer::write_int64(const int64_t data)
+	{
+		this->write_data_type(9);
+		return this->write(8, &data);
+	}
+
+	bool byte_writer::write_uint64(const uint64_t data)
+	{
+		this->write_data_type(10);
+		return this->write(8, &data);
+	}
+
+	bool byte_writer::write_data_type(const char data)
+	{
+		if (!this->use_data_types_) return true;
+		return this->write(1, &data);
+	}
+
+	bool byte_writer::write_float(const float data)
+	{
+		this->write_data_type(13);
+		return this->write(4, &data);
+	}
+
+	bool byte_writer::write_string(const std::string_view data)
+	{
+		this->write_data_type(16);
+		this->write(data);
+		return this->write(1, "");
+	}
+
+	bool byte_writer::write_blob(const std::string_view data)
+	{
+		this->write_data_type(0x13);
+		this->write_uint32(static_cast<unsigned int>(data.size()));
+
+		return this->write(data);
+	}
+
+	bool byte_writer::write_array_header(const unsigned char type, const unsigned int element_count,
+	                                     const unsigned int element_size)
+	{
+		const auto using_types = this->is_using_data_types();
+		this->set_use_data_types(false);
+
+		auto result = this->write_byte(static_cast<char>(type + 100));
+
+		this->set_use_data_types(true);
+		result &= this->write_uint32(element_count * element_size);
+		this->set_use_data_types(false);
+
+		result &= this->write_uint32(element_count);
+
+		this->set_use_data_types(using_types);
+		return result;
+	}
+
+	bool byte_writer::write(const size_t bytes, const void* data)
+	{
+		this->buffer_->append(static_cast<const char*>(data), bytes);
+		return true;
+	}
+
+	bool byte_writer::write(const std::string_view data)
+	{
+		return this->write(data.size(), data.data());
+	}
+
+	void byte_writer::set_use_data_types(const bool use_data_types)
+	{
+		this->use_data_types_ = use_data_types;
+	}
+
+	bool byte_writer::is_using_data_types() const
+	{
+		return this->use_data_types_;
+	}
+
+	size_t byte_writer::size() const
+	{
+		return this->buffer_->size();
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+namespace demonware
+{
+	// Appends byte_buffer-compatible data to a caller-owned string.
+	// Reserve the target up front to serialize without reallocating.
+	class byte_writer final
+	{
+	public:
+		explicit byte_writer(std::string& buffer) : buffer_(&buffer)
+		{
+		}
+
+		bool write_byte(char data);
+		bool write_bool(bool data);
+		bool write_int16(short data);
+		bool write_uint16(unsigned short data);
+		bool write_int32(int data);
+		bool write_uint32(unsigned int data);
+		bool write_int64(int64_t data);
+		bool write_uint64(uint64_t data);
+		bool write_data_type(char data);
+		bool write_float(float data);
+		bool write_string(std::string_view data);
+		bool write_blob(std::string_view data);
+
+		bool write_array_header(unsigned char type, unsigned int element_count, unsigned int element_size);
+
+		bool write(size_t bytes, const void* data);
+		bool write(std::string_view data);
+
+		void set_use_data_types(bool use_data_types);
+		bool is_using_data_types() const;
+
+		size_t size() const;
+
+	private:
+		std::string* buffer_;
+		bool use_data_types_ = true;
+	};
+}
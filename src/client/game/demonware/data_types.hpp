@@ -27,15 +27,23 @@ namespace demonware
 		{
 		}
 
+		explicit bdFileData(std::shared_ptr<const std::string> buffer) : shared_data_(std::move(buffer))
+		{
+		}
+
 		void serialize(byte_buffer* buffer) override
 		{
-			buffer->write_blob(this->file_data);
+			buffer->write_blob(this->shared_data_ ? *this->shared_data_ : this->file_data);
 		}
 
 		void deserialize(byte_buffer* buffer) override
 		{
+			this->shared_data_.reset();
 			buffer->read_blob(&this->file_data);
 		}
+
+	private:
+		std::shared_ptr<const std::string> shared_data_;
 	};
 
 	class bdFileInfo final : public bdTaskResult
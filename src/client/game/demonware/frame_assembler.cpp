@@ -0,0 +1,65 @@
+#include <std_include.hpp>
+#include "frame_assembler.hpp"
+
+namespace demonware
+{
+	void frame_assembler::push(const std::string_view data)
+	{
+		if (this->input_.empty())
+		{
+			this->input_ = data;
+			return;
+		}
+
+		if (this->is_buffered())
+		{
+			// Drop the consumed prefix, moving only the partial frame
+			this->buffer_.erase(0, static_cast<size_t>(this->input_.data() - this->buffer_.data()));
+		}
+		else
+		{
+			this->buffer_.assign(this->input_);
+		}
+
+		this->buffer_.append(data);
+		this->input_ = this->buffer_;
+	}
+
+	std::string_view frame_assembler::peek() const
+	{
+		return this->input_;
+	}
+
+	void frame_assembler::consume(const size_t size)
+	{
+		this->input_.remove_prefix(std::min(size, this->input_.size()));
+
+		if (this->input_.empty())
+		{
+			this->input_ = {};
+			this->buffer_.clear();
+		}
+	}
+
+	void frame_assembler::retain()
+	{
+		if (this->input_.empty() || this->is_buffered())
+		{
+			return;
+		}
+
+		this->buffer_.assign(this->input_);
+		this->input_ = this->buffer_;
+	}
+
+	size_t frame_assembler::size() const
+	{
+		return this->input_.size();
+	}
+
+	bool frame_assembler::is_buffered() const
+	{
+		return !this->buffer_.empty() && this->input_.data() >= this->buffer_.data()
+			&& this->input_.data() < this->buffer_.data() + this->buffer_.size();
+	}
+}
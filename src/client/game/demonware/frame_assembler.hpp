@@ -0,0 +1,29 @@
+#pragma once
+
+namespace demonware
+{
+	// Collects stream data until whole frames are available. Data that is
+	// consumed while it is still being handled is never copied; only a
+	// trailing partial frame is kept until the rest of it arrives.
+	class frame_assembler final
+	{
+	public:
+		// The data has to stay alive until retain is called
+		void push(std::string_view data);
+
+		// Everything received but not consumed yet
+		std::string_view peek() const;
+		void consume(size_t size);
+
+		// Copies whatever was not consumed out of the data passed to push
+		void retain();
+
+		size_t size() const;
+
+	private:
+		std::string buffer_;
+		std::string_view input_;
+
+		bool is_buffered() const;
+	};
+}
@@ -6,77 +6,76 @@
 
 namespace demonware
 {
-	struct data_t
+	namespace
 	{
-		char m_session_key[24];
-		char m_response[8];
-		char m_hmac_key[20];
-		char m_enc_key[16];
-		char m_dec_key[16];
-	} data{};
-
-	std::string packet_buffer;
-
-	void calculate_hmacs_s1(const char* data_, const unsigned int data_size, const char* key,
-	                        const unsigned int key_size,
-	                        char* dst, const unsigned int dst_size)
-	{
-		char buffer[64];
-		unsigned int pos = 0;
-		unsigned int out_offset = 0;
-		char count = 1;
-		std::string result;
-
-		// buffer add key
-		std::memcpy(&buffer[pos], key, key_size);
-		pos += key_size;
-
-		// buffer add count
-		buffer[pos] = count;
-		pos++;
+		char session_key_data[24]{};
 
-		// calculate hmac
-		result = utils::cryptography::hmac_sha1::compute(std::string(buffer, pos), std::string(data_, data_size));
-
-		// save output
-		std::memcpy(dst, result.data(), std::min(20u, (dst_size - out_offset)));
-		out_offset = 20;
-
-		// second loop
-		while (true)
+		void calculate_hmacs_s1(const char* data_, const unsigned int data_size, const char* key,
+		                        const unsigned int key_size,
+		                        char* dst, const unsigned int dst_size)
 		{
-			// if we filled the output buffer, exit
-			if (out_offset >= dst_size)
-				break;
+			constexpr auto digest_size = static_cast<unsigned int>(utils::cryptography::hmac_sha1::digest_size);
+
+			char buffer[64];
+			uint8_t result[digest_size];
+			unsigned int pos = 0;
+			unsigned int out_offset = 0;
+			char count = 1;
 
-			// buffer add last result
-			pos = 0;
-			std::memcpy(&buffer[pos], result.data(), 20);
-			pos += 20;
+			// data_ is the hmac key for every round
+			const utils::cryptography::hmac_sha1::context hmac(std::string(data_, data_size));
 
 			// buffer add key
 			std::memcpy(&buffer[pos], key, key_size);
 			pos += key_size;
 
 			// buffer add count
-			count++;
 			buffer[pos] = count;
 			pos++;
 
 			// calculate hmac
-			result = utils::cryptography::hmac_sha1::compute(std::string(buffer, pos), std::string(data_, data_size));
+			hmac.compute(reinterpret_cast<const uint8_t*>(buffer), pos, result);
 
 			// save output
-			std::memcpy(dst + out_offset, result.data(), std::min(20u, (dst_size - out_offset)));
-			out_offset += 20;
+			std::memcpy(dst, result, std::min(digest_size, (dst_size - out_offset)));
+			out_offset = digest_size;
+
+			// second loop
+			while (true)
+			{
+				// if we filled the output buffer, exit
+				if (out_offset >= dst_size)
+					break;
+
+				// buffer add last result
+				pos = 0;
+				std::memcpy(&buffer[pos], result, digest_size);
+				pos += digest_size;
+
+				// buffer add key
+				std::memcpy(&buffer[pos], key, key_size);
+				pos += key_size;
+
+				// buffer add count
+				count++;
+				buffer[pos] = count;
+				pos++;
+
+				// calculate hmac
+				hmac.compute(reinterpret_cast<const uint8_t*>(buffer), pos, result);
+
+				// save output
+				std::memcpy(dst + out_offset, result, std::min(digest_size, (dst_size - out_offset)));
+				out_offset += digest_size;
+			}
 		}
 	}
 
-	void derive_keys_s1()
+	void session_keys::derive_keys_s1(const std::string& session_key)
 	{
-		const auto out_1 = utils::cryptography::sha1::compute(packet_buffer); // out_1 size 20
+		const auto out_1 = utils::cryptography::sha1::compute(this->packet_buffer_); // out_1 size 20
 
-		auto data_3 = utils::cryptography::hmac_sha1::compute(data.m_session_key, out_1);
+		auto data_3 = utils::cryptography::hmac_sha1::compute(session_key, out_1);
 
 		char out_2[16];
 		calculate_hmacs_s1(data_3.data(), 20, "CLIENTCHAL", 10, out_2, 16);
@@ -84,10 +83,14 @@ namespace demonware
 		char out_3[72];
 		calculate_hmacs_s1(data_3.data(), 20, "BDDATA", 6, out_3, 72);
 
-		std::memcpy(data.m_response, &out_2[8], 8);
-		std::memcpy(data.m_hmac_key, &out_3[20], 20);
-		std::memcpy(data.m_dec_key, &out_3[40], 16);
-		std::memcpy(data.m_enc_key, &out_3[56], 16);
+		std::memcpy(this->data_.m_response, &out_2[8], 8);
+		std::memcpy(this->data_.m_hmac_key, &out_3[20], 20);
+		std::memcpy(this->data_.m_dec_key, &out_3[40], 16);
+		std::memcpy(this->data_.m_enc_key, &out_3[56], 16);
+
+		this->decrypt_context_.set_key(reinterpret_cast<const uint8_t*>(this->data_.m_dec_key), sizeof(this->data_.m_dec_key));
+		this->encrypt_context_.set_key(reinterpret_cast<const uint8_t*>(this->data_.m_enc_key), sizeof(this->data_.m_enc_key));
+		this->hmac_context_.set_key(reinterpret_cast<const uint8_t*>(this->data_.m_hmac_key), sizeof(this->data_.m_hmac_key));
 
 #ifdef DEBUG
 		printf("[DW] Response id: %s\n", utils::string::dump_hex(std::string(&out_2[8], 8)).data());
@@ -98,33 +101,53 @@ namespace demonware
 #endif
 	}
 
-	void queue_packet_to_hash(const std::string& packet)
+	void set_session_key(const std::string& key)
 	{
-		packet_buffer.append(packet);
+		std::memcpy(session_key_data, key.data(), sizeof(session_key_data));
 	}
 
-	void set_session_key(const std::string& key)
+	std::string get_session_key()
+	{
+		return std::string(session_key_data, sizeof(session_key_data));
+	}
+
+	void session_keys::queue_packet_to_hash(const std::string_view packet)
+	{
+		this->packet_buffer_.append(packet);
+	}
+
+	std::string session_keys::get_decrypt_key() const
+	{
+		return std::string(this->data_.m_dec_key, 16);
+	}
+
+	std::string session_keys::get_encrypt_key() const
+	{
+		return std::string(this->data_.m_enc_key, 16);
+	}
+
+	std::string session_keys::get_hmac_key() const
 	{
-		std::memcpy(data.m_session_key, key.data(), 24);
+		return std::string(this->data_.m_hmac_key, 20);
 	}
 
-	std::string get_decrypt_key()
+	std::string session_keys::get_response_id() const
 	{
-		return std::string(data.m_dec_key, 16);
+		return std::string(this->data_.m_response, 8);
 	}
 
-	std::string get_encrypt_key()
+	utils::cryptography::aes::context& session_keys::get_decrypt_context()
 	{
-		return std::string(data.m_enc_key, 16);
+		return this->decrypt_context_;
 	}
 
-	std::string get_hmac_key()
+	utils::cryptography::aes::context& session_keys::get_encrypt_context()
 	{
-		return std::string(data.m_hmac_key, 20);
+		return this->encrypt_context_;
 	}
 
-	std::string get_response_id()
+	const utils::cryptography::hmac_sha1::context& session_keys::get_hmac_context() const
 	{
-		return std::string(data.m_response, 8);
+		return this->hmac_context_;
 	}
 }
@@ -1,12 +1,43 @@
 #pragma once
 
+#include <utils/cryptography.hpp>
+
 namespace demonware
 {
-	void derive_keys_s1();
-	void queue_packet_to_hash(const std::string& packet);
+	// Issued by auth3 and shared by every lobby session
 	void set_session_key(const std::string& key);
-	std::string get_decrypt_key();
-	std::string get_encrypt_key();
-	std::string get_hmac_key();
-	std::string get_response_id();
+	std::string get_session_key();
+
+	// Handshake transcript and derived keys of a single lobby connection
+	class session_keys final
+	{
+	public:
+		void queue_packet_to_hash(std::string_view packet);
+		void derive_keys_s1(const std::string& session_key);
+
+		std::string get_decrypt_key() const;
+		std::string get_encrypt_key() const;
+		std::string get_hmac_key() const;
+		std::string get_response_id() const;
+
+		// Keyed once per session by derive_keys_s1
+		utils::cryptography::aes::context& get_decrypt_context();
+		utils::cryptography::aes::context& get_encrypt_context();
+		const utils::cryptography::hmac_sha1::context& get_hmac_context() const;
+
+	private:
+		struct data_t
+		{
+			char m_response[8];
+			char m_hmac_key[20];
+			char m_enc_key[16];
+			char m_dec_key[16];
+		} data_{};
+
+		std::string packet_buffer_;
+
+		utils::cryptography::aes::context decrypt_context_;
+		utils::cryptography::aes::context encrypt_context_;
+		utils::cryptography::hmac_sha1::context hmac_context_;
+	};
 }
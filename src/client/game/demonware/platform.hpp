@@ -0,0 +1,8 @@
+#pragma once
+
+// Provided by whatever hosts the emulator: the client component or dw-host
+namespace demonware::platform
+{
+	std::string load_resource(int id);
+	std::string get_motd();
+}
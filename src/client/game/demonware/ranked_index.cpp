@@ -0,0 +1,192 @@
+#include <std_include.hpp>
+#include "ranked_index.hpp"
+
+namespace demonware
+{
+	void ranked_index::insert(const entry& value)
+	{
+		int32_t left, right;
+		this->split(this->root_, value, left, right);
+		this->root_ = this->merge(this->merge(left, this->allocate(value)), right);
+	}
+
+	bool ranked_index::erase(const entry& value)
+	{
+		// Walk down to the node and splice its children in its place
+		auto* link = &this->root_;
+		std::vector<int32_t> path;
+
+		while (*link != null_node)
+		{
+			auto& current = this->nodes_[*link];
+
+			if (before(value, current.value))
+			{
+				path.push_back(*link);
+				link = &current.left;
+			}
+			else if (before(current.value, value))
+			{
+				path.push_back(*link);
+				link = &current.right;
+			}
+			else
+			{
+				const auto index = *link;
+				*link = this->merge(current.left, current.right);
+				this->free_nodes_.push_back(index);
+
+				for (auto parent = path.rbegin(); parent != path.rend(); ++parent)
+				{
+					this->update(*parent);
+				}
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	size_t ranked_index::rank(const entry& value) const
+	{
+		size_t rank = 0;
+		auto index = this->root_;
+
+		while (index != null_node)
+		{
+			const auto& current = this->nodes_[index];
+			if (before(current.value, value))
+			{
+				rank += this->size_of(current.left) + 1;
+				index = current.right;
+			}
+			else
+			{
+				index = current.left;
+			}
+		}
+
+		return rank;
+	}
+
+	ranked_index::entry ranked_index::at(size_t rank) const
+	{
+		auto index = this->root_;
+
+		while (index != null_node)
+		{
+			const auto& current = this->nodes_[index];
+			const auto left_size = this->size_of(current.left);
+
+			if (rank < left_size)
+			{
+				index = current.left;
+			}
+			else if (rank == left_size)
+			{
+				return current.value;
+			}
+			else
+			{
+				rank -= left_size + 1;
+				index = current.right;
+			}
+		}
+
+		throw std::out_of_range("Rank out of range");
+	}
+
+	size_t ranked_index::size() const
+	{
+		return this->size_of(this->root_);
+	}
+
+	void ranked_index::reserve(const size_t size)
+	{
+		this->nodes_.reserve(size);
+	}
+
+	bool ranked_index::before(const entry& a, const entry& b)
+	{
+		if (a.rating != b.rating)
+		{
+			return a.rating > b.rating;
+		}
+
+		return a.entity_id < b.entity_id;
+	}
+
+	uint32_t ranked_index::size_of(const int32_t index) const
+	{
+		return index == null_node ? 0 : this->nodes_[index].size;
+	}
+
+	void ranked_index::update(const int32_t index)
+	{
+		auto& current = this->nodes_[index];
+		current.size = this->size_of(current.left) + this->size_of(current.right) + 1;
+	}
+
+	int32_t ranked_index::allocate(const entry& value)
+	{
+		// xorshift is plenty to keep the treap balanced
+		this->seed_ ^= this->seed_ << 13;
+		this->seed_ ^= this->seed_ >> 17;
+		this->seed_ ^= this->seed_ << 5;
+
+		const node new_node{value, this->seed_, 1, null_node, null_node};
+
+		if (!this->free_nodes_.empty())
+		{
+			const auto index = this->free_nodes_.back();
+			this->free_nodes_.pop_back();
+			this->nodes_[index] = new_node;
+			return index;
+		}
+
+		this->nodes_.push_back(new_node);
+		return static_cast<int32_t>(this->nodes_.size() - 1);
+	}
+
+	// Everything ordered before the value goes left, the rest right
+	void ranked_index::split(const int32_t index, const entry& value, int32_t& left, int32_t& right)
+	{
+		if (index == null_node)
+		{
+			left = right = null_node;
+			return;
+		}
+
+		auto& current = this->nodes_[index];
+		if (before(current.value, value))
+		{
+			this->split(current.right, value, current.right, right);
+			left = index;
+		}
+		else
+		{
+			this->split(current.left, value, left, current.left);
+			right = index;
+		}
+
+		this->update(index);
+	}
+
+	int32_t ranked_index::merge(const int32_t left, const int32_t right)
+	{
+		if (left == null_node) return right;
+		if (right == null_node) return left;
+
+		if (this->nodes_[left].priority > this->nodes_[right].priority)
+		{
+			this->nodes_[left].right = this->merge(this->nodes_[left].right, right);
+			this->update(left);
+			return left;
+		}
+
+		this->nodes_[right].left = this->merge(left, this->nodes_[right].left);
+		this->update(right);
+		return right;
+	}
+}
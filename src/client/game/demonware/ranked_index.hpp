@@ -0,0 +1,52 @@
+#pragma once
+
+namespace demonware
+{
+	// Order statistic treap over leaderboard entries, higher ratings rank first.
+	// Insertion, removal, rank lookup and access by rank are all O(log n).
+	class ranked_index final
+	{
+	public:
+		struct entry
+		{
+			int64_t rating;
+			uint64_t entity_id;
+		};
+
+		void insert(const entry& value);
+		bool erase(const entry& value);
+
+		// Zero-based position the entry has or would have
+		size_t rank(const entry& value) const;
+		entry at(size_t rank) const;
+
+		size_t size() const;
+		void reserve(size_t size);
+
+	private:
+		static constexpr int32_t null_node = -1;
+
+		struct node
+		{
+			entry value;
+			uint32_t priority;
+			uint32_t size;
+			int32_t left;
+			int32_t right;
+		};
+
+		std::vector<node> nodes_;
+		std::vector<int32_t> free_nodes_;
+		int32_t root_ = null_node;
+		uint32_t seed_ = 0x9E3779B9;
+
+		static bool before(const entry& a, const entry& b);
+
+		uint32_t size_of(int32_t index) const;
+		void update(int32_t index);
+
+		int32_t allocate(const entry& value);
+		void split(int32_t index, const entry& value, int32_t& left, int32_t& right);
+		int32_t merge(int32_t left, int32_t right);
+	};
+}
@@ -1,6 +1,7 @@
 #include <std_include.hpp>
 #include "keys.hpp"
 #include "reply.hpp"
+#include "byte_writer.hpp"
 #include "servers/service_server.hpp"
 
 #include <utils/cryptography.hpp>
@@ -9,67 +10,82 @@ namespace demonware
 {
 	std::string unencrypted_reply::data()
 	{
-		byte_buffer result;
-		result.set_use_data_types(false);
+		std::string result;
+		result.reserve(this->buffer_.size() + 6);
 
-		result.write_int32(static_cast<int>(this->buffer_.size()) + 2);
-		result.write_bool(false);
-		result.write_byte(this->type());
-		result.write(this->buffer_);
+		byte_writer writer(result);
+		writer.set_use_data_types(false);
 
-		return result.get_buffer();
+		writer.write_int32(static_cast<int>(this->buffer_.size()) + 2);
+		writer.write_bool(false);
+		writer.write_byte(this->type());
+		writer.write(this->buffer_);
+
+		return result;
 	}
 
 	std::string encrypted_reply::data()
 	{
-		byte_buffer result;
-		result.set_use_data_types(false);
+		const auto size = ~15 & (this->buffer_.size() + 5 + 15); // 16 byte align
+
+		std::string aligned_data;
+		aligned_data.reserve(size);
 
-		byte_buffer enc_buffer;
+		byte_writer enc_buffer(aligned_data);
 		enc_buffer.set_use_data_types(false);
 
 		enc_buffer.write_uint32(static_cast<unsigned int>(this->buffer_.size())); // service data size CHECKTHIS!!
 		enc_buffer.write_byte(this->type()); // TASK_REPLY type
 		enc_buffer.write(this->buffer_); // service data
 
-		auto aligned_data = enc_buffer.get_buffer();
-		auto size = aligned_data.size();
-		size = ~15 & (size + 15); // 16 byte align
 		aligned_data.resize(size);
 
 		// seed
-		std::string seed("\x5E\xED\x5E\xED\x5E\xED\x5E\xED\x5E\xED\x5E\xED\x5E\xED\x5E\xED", 16);
-
-		// encrypt
-		const auto enc_data = utils::cryptography::aes::encrypt(aligned_data, seed, demonware::get_encrypt_key());
+		constexpr uint8_t seed[16] =
+		{
+			0x5E, 0xED, 0x5E, 0xED, 0x5E, 0xED, 0x5E, 0xED, 0x5E, 0xED, 0x5E, 0xED, 0x5E, 0xED, 0x5E, 0xED
+		};
 
 		// header : encrypted service data : hash
 		static auto msg_count = 0;
 		msg_count++;
 
-		byte_buffer response;
+		constexpr size_t header_size = 26;
+		constexpr size_t hash_size = 8;
+
+		std::string result;
+		result.reserve(header_size + size + hash_size);
+
+		byte_writer response(result);
 		response.set_use_data_types(false);
 
-		response.write_int32(30 + static_cast<int>(enc_data.size()));
+		response.write_int32(static_cast<int>(header_size - 4 + size + hash_size));
 		response.write_byte(static_cast<char>(0xAB));
 		response.write_byte(static_cast<char>(0x85));
 		response.write_int32(msg_count);
-		response.write(16, seed.data());
-		response.write(enc_data);
+		response.write(sizeof(seed), seed);
+
+		// encrypt straight into the packet
+		result.resize(header_size + size);
+		if (!this->keys_.get_encrypt_context().encrypt(reinterpret_cast<const uint8_t*>(aligned_data.data()), size, seed,
+		                                               reinterpret_cast<uint8_t*>(result.data()) + header_size))
+		{
+			return {};
+		}
 
 		// hash entire packet and append end
-		auto hash_data = utils::cryptography::hmac_sha1::compute(response.get_buffer(), demonware::get_hmac_key());
-		hash_data.resize(8);
-		response.write(8, hash_data.data());
+		uint8_t hash_data[utils::cryptography::hmac_sha1::digest_size];
+		this->keys_.get_hmac_context().compute(reinterpret_cast<const uint8_t*>(result.data()), result.size(), hash_data);
+		response.write(hash_size, hash_data);
 
-		return response.get_buffer();
+		return result;
 	}
 
 	void remote_reply::send(bit_buffer* buffer, const bool encrypted)
 	{
 		std::unique_ptr<typed_reply> reply;
 
-		if (encrypted) reply = std::make_unique<encrypted_reply>(this->type_, buffer);
+		if (encrypted) reply = std::make_unique<encrypted_reply>(this->server_->get_keys(), this->type_, buffer);
 		else reply = std::make_unique<unencrypted_reply>(this->type_, buffer);
 
 		this->server_->send_reply(reply.get());
@@ -79,7 +95,7 @@ namespace demonware
 	{
 		std::unique_ptr<typed_reply> reply;
 
-		if (encrypted) reply = std::make_unique<encrypted_reply>(this->type_, buffer);
+		if (encrypted) reply = std::make_unique<encrypted_reply>(this->server_->get_keys(), this->type_, buffer);
 		else reply = std::make_unique<unencrypted_reply>(this->type_, buffer);
 
 		this->server_->send_reply(reply.get());
@@ -52,20 +52,25 @@ namespace demonware
 		uint8_t type_;
 	};
 
+	class session_keys;
+
 	class encrypted_reply final : public typed_reply
 	{
 	public:
-		encrypted_reply(const uint8_t type, bit_buffer* bbuffer) : typed_reply(type)
+		encrypted_reply(session_keys& keys, const uint8_t type, bit_buffer* bbuffer) : typed_reply(type), keys_(keys)
 		{
 			this->buffer_.append(bbuffer->get_buffer());
 		}
 
-		encrypted_reply(const uint8_t type, byte_buffer* bbuffer) : typed_reply(type)
+		encrypted_reply(session_keys& keys, const uint8_t type, byte_buffer* bbuffer) : typed_reply(type), keys_(keys)
 		{
 			this->buffer_.append(bbuffer->get_buffer());
 		}
 
 		std::string data() override;
+
+	private:
+		session_keys& keys_;
 	};
 
 	class unencrypted_reply final : public typed_reply
@@ -1,7 +1,6 @@
 #pragma once
 
 #include "servers/base_server.hpp"
-#include <utils/cryptography.hpp>
 
 namespace demonware
 {
@@ -18,43 +17,136 @@ namespace demonware
 
 			auto server = std::make_unique<S>(std::forward<Args>(args)...);
 			const auto address = server->get_address();
-			servers_[address] = std::move(server);
+
+			const auto existing = std::find_if(servers_.begin(), servers_.end(), [&](const std::unique_ptr<T>& entry)
+			{
+				return entry->get_address() == address;
+			});
+
+			if (existing != servers_.end())
+			{
+				*existing = std::move(server);
+			}
+			else
+			{
+				servers_.emplace_back(std::move(server));
+			}
+
+			// Servers are only created at startup, so the indices are simply rebuilt
+			this->build_index();
 		}
 
-		void for_each(const std::function<void(T&)>& callback) const
+		template <typename F>
+		void for_each(F&& callback) const
 		{
-			for (auto& server : servers_)
+			for (const auto& server : servers_)
 			{
-				callback(*server.second);
+				callback(*server);
 			}
 		}
 
-		T* find(const std::string& name)
+		T* find(const std::string_view name) const
 		{
-			const auto address = utils::cryptography::jenkins_one_at_a_time::compute(name);
-			return find(address);
+			if (name.size() >= length_mask_.size() || !length_mask_[name.size()])
+			{
+				return nullptr;
+			}
+
+			const auto it = std::lower_bound(names_.begin(), names_.end(), name,
+			                                 [](const name_entry& entry, const std::string_view value)
+			                                 {
+				                                 return compare_names(entry.name, value);
+			                                 });
+
+			if (it == names_.end() || it->name != name)
+			{
+				return nullptr;
+			}
+
+			return it->server;
 		}
 
-		T* find(const uint32_t address)
+		T* find(const uint32_t address) const
 		{
-			const auto it = servers_.find(address);
-			if (it == servers_.end())
+			const auto it = std::lower_bound(addresses_.begin(), addresses_.end(), address);
+			if (it == addresses_.end() || *it != address)
 			{
 				return nullptr;
 			}
 
-			return it->second.get();
+			return address_servers_[static_cast<size_t>(it - addresses_.begin())];
 		}
 
 		void frame()
 		{
 			for (auto& server : servers_)
 			{
-				server.second->frame();
+				server->frame();
 			}
 		}
 
 	private:
-		std::unordered_map<uint32_t, std::unique_ptr<T>> servers_;
+		struct name_entry
+		{
+			std::string_view name;
+			T* server;
+		};
+
+		std::vector<std::unique_ptr<T>> servers_;
+
+		// Sorted by length first, so most misses are settled by the length mask
+		std::vector<name_entry> names_;
+		std::bitset<256> length_mask_;
+
+		std::vector<uint32_t> addresses_;
+		std::vector<T*> address_servers_;
+
+		static bool compare_names(const std::string_view a, const std::string_view b)
+		{
+			if (a.size() != b.size())
+			{
+				return a.size() < b.size();
+			}
+
+			return a < b;
+		}
+
+		void build_index()
+		{
+			names_.clear();
+			length_mask_.reset();
+			addresses_.clear();
+			address_servers_.clear();
+
+			std::vector<T*> by_address;
+
+			for (const auto& server : servers_)
+			{
+				const std::string_view name = server->get_name();
+				if (name.size() < length_mask_.size())
+				{
+					names_.push_back({name, server.get()});
+					length_mask_.set(name.size());
+				}
+
+				by_address.push_back(server.get());
+			}
+
+			std::sort(names_.begin(), names_.end(), [](const name_entry& a, const name_entry& b)
+			{
+				return compare_names(a.name, b.name);
+			});
+
+			std::sort(by_address.begin(), by_address.end(), [](const T* a, const T* b)
+			{
+				return a->get_address() < b->get_address();
+			});
+
+			for (auto* server : by_address)
+			{
+				addresses_.push_back(server->get_address());
+				address_servers_.push_back(server);
+			}
+		}
 	};
 }
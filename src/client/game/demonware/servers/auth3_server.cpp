@@ -18,8 +18,8 @@ namespace demonware
 			unsigned int m_titleID;
 			unsigned int m_timeIssued;
 			unsigned int m_timeExpires;
-			unsigned __int64 m_licenseID;
-			unsigned __int64 m_userID;
+			uint64_t m_licenseID;
+			uint64_t m_userID;
 			char m_username[64];
 			char m_sessionKey[24];
 			char m_usingHashMagicNumber[3];
@@ -36,12 +36,19 @@ namespace demonware
 
 	void auth3_server::handle(const std::string& packet)
 	{
-		if (packet.starts_with("POST /auth/"))
+		std::string_view body = packet;
+		if (body.starts_with("POST /auth/"))
 		{
 #ifdef DEBUG
 			printf("[DW]: [auth]: user requested authentication.\n");
 #endif
-			return;
+
+			// the game sends headers and body separately, real sockets might not
+			const auto header_end = body.find("\r\n\r\n");
+			if (header_end == std::string_view::npos) return;
+
+			body.remove_prefix(header_end + 4);
+			if (body.empty()) return;
 		}
 
 		unsigned int title_id = 0;
@@ -50,7 +57,7 @@ namespace demonware
 		std::string token{};
 
 		rapidjson::Document j;
-		j.Parse(packet.data(), packet.size());
+		j.Parse(body.data(), body.size());
 
 		if (j.HasMember("title_id") && j["title_id"].IsString())
 		{
@@ -76,6 +83,8 @@ namespace demonware
 			}
 		}
 
+		if (token.size() < 128) return;
+
 #ifdef DEBUG
 		printf("[DW]: [auth]: authenticating user %s\n", token.data() + 64);
 #endif
@@ -94,7 +103,7 @@ namespace demonware
 		ticket.m_timeExpires = ticket.m_timeIssued + 30000;
 		ticket.m_licenseID = 0;
 		ticket.m_userID = reinterpret_cast<uint64_t>(token.data() + 56);
-		strncpy_s(ticket.m_username, sizeof(ticket.m_username), reinterpret_cast<char*>(token.data() + 64), 64);
+		std::strncpy(ticket.m_username, reinterpret_cast<char*>(token.data() + 64), sizeof(ticket.m_username) - 1);
 		std::memcpy(ticket.m_sessionKey, session_key.data(), 24);
 
 		const auto iv = utils::cryptography::tiger::compute(std::string(reinterpret_cast<char*>(&iv_seed), 4));
@@ -115,7 +124,11 @@ namespace demonware
 		char date[64];
 		const auto now = time(nullptr);
 		tm gmtm{};
+#ifdef _WIN32
 		gmtime_s(&gmtm, &now);
+#else
+		gmtime_r(&now, &gmtm);
+#endif
 		strftime(date, 64, "%a, %d %b %G %T", &gmtm);
 
 		// json content
@@ -3,6 +3,8 @@
 
 #include "../services.hpp"
 #include "../keys.hpp"
+#include "../byte_reader.hpp"
+#include "../trace.hpp"
 
 #include <utils/cryptography.hpp>
 
@@ -36,142 +38,191 @@ namespace demonware
 		this->send(data->data());
 	}
 
+	session_keys& lobby_server::get_keys()
+	{
+		return this->keys_;
+	}
+
 	void lobby_server::handle(const std::string& packet)
 	{
-		byte_buffer buffer(packet);
-		buffer.set_use_data_types(false);
+		this->frames_.push(packet);
 
 		try
 		{
-			while (buffer.has_more_data())
+			while (true)
 			{
+				const auto data = this->frames_.peek();
+
 				int size;
-				buffer.read_int32(&size);
+				if (data.size() < sizeof(size)) break;
+				std::memcpy(&size, data.data(), sizeof(size));
 
 				if (size <= 0)
 				{
 					const std::string zero("\x00\x00\x00\x00", 4);
 					raw_reply reply(zero);
 					this->send_reply(&reply);
-					return;
+
+					this->frames_.consume(sizeof(size));
+					continue;
 				}
-				else if (size == 0xC8)
+
+				if (size == 0xC8)
+				{
+					// The client header is not length prefixed and is sent on its own
+					this->handle_client_header(data);
+					this->frames_.consume(data.size());
+					continue;
+				}
+
+				if (size > max_frame_size)
 				{
+					printf("[DW]: [lobby]: ERROR! frame too large.\n");
+					this->frames_.consume(data.size());
+					break;
+				}
+
+				const auto frame_size = sizeof(size) + static_cast<size_t>(size);
+				if (data.size() < frame_size) break;
+
+				this->handle_frame(data.substr(0, frame_size));
+				this->frames_.consume(frame_size);
+			}
+		}
+		catch (...)
+		{
+			this->frames_.consume(this->frames_.size());
+		}
+
+		this->frames_.retain();
+	}
+
+	void lobby_server::handle_client_header(const std::string_view packet)
+	{
 #ifdef DEBUG
-					printf("[DW]: [lobby]: received client_header_ack.\n");
+		printf("[DW]: [lobby]: received client_header_ack.\n");
 #endif
 
-					int c8;
-					buffer.read_int32(&c8);
-					std::string packet_1 = buffer.get_remaining();
-					demonware::queue_packet_to_hash(packet_1);
+		this->keys_.queue_packet_to_hash(packet.substr(std::min(packet.size(), size_t(8))));
 
-					const std::string packet_2(
-						"\x16\x00\x00\x00\xab\x81\xd2\x00\x00\x00\x13\x37\x13\x37\x13\x37\x13\x37\x13\x37\x13\x37\x13\x37\x13\x37",
-						26);
-					demonware::queue_packet_to_hash(packet_2);
+		const std::string packet_2(
+			"\x16\x00\x00\x00\xab\x81\xd2\x00\x00\x00\x13\x37\x13\x37\x13\x37\x13\x37\x13\x37\x13\x37\x13\x37\x13\x37",
+			26);
+		this->keys_.queue_packet_to_hash(packet_2);
 
-					raw_reply reply(packet_2);
-					this->send_reply(&reply);
+		raw_reply reply(packet_2);
+		this->send_reply(&reply);
 #ifdef DEBUG
-					printf("[DW]: [lobby]: sending server_header_ack.\n");
+		printf("[DW]: [lobby]: sending server_header_ack.\n");
 #endif
-					return;
-				}
+	}
 
-				if (buffer.size() < size_t(size)) return;
+	void lobby_server::handle_frame(const std::string_view packet)
+	{
+		byte_reader buffer(packet);
+		buffer.set_use_data_types(false);
+		buffer.skip(sizeof(int));
 
-				uint8_t check_ab;
-				buffer.read_byte(&check_ab);
-				if (check_ab == 0xAB)
-				{
-					uint8_t type;
-					buffer.read_byte(&type);
+		uint8_t check_ab;
+		if (!buffer.read_byte(&check_ab)) return;
+		if (check_ab == 0xAB)
+		{
+			uint8_t type;
+			if (!buffer.read_byte(&type)) return;
 
-					if (type == 0x82)
-					{
+			if (type == 0x82)
+			{
 #ifdef DEBUG
-						printf("[DW]: [lobby]: received client_auth.\n");
+				printf("[DW]: [lobby]: received client_auth.\n");
 #endif
-						std::string packet_3(packet.data(), packet.size() - 8); // this 8 are client hash check?
+				if (packet.size() < 8) return;
 
-						demonware::queue_packet_to_hash(packet_3);
-						demonware::derive_keys_s1();
+				// this 8 are client hash check?
+				this->keys_.queue_packet_to_hash(packet.substr(0, packet.size() - 8));
+				this->keys_.derive_keys_s1(demonware::get_session_key());
 
-						char buff[14] = "\x0A\x00\x00\x00\xAB\x83";
-						std::memcpy(&buff[6], demonware::get_response_id().data(), 8);
-						std::string response(buff, 14);
+				char buff[14] = "\x0A\x00\x00\x00\xAB\x83";
+				std::memcpy(&buff[6], this->keys_.get_response_id().data(), 8);
+				std::string response(buff, 14);
 
-						raw_reply reply(response);
-						this->send_reply(&reply);
+				raw_reply reply(response);
+				this->send_reply(&reply);
 
 #ifdef DEBUG
-						printf("[DW]: [lobby]: sending server_auth_done.\n");
+				printf("[DW]: [lobby]: sending server_auth_done.\n");
 #endif
-						return;
-					}
-					else if (type == 0x85)
-					{
-						uint32_t msg_count;
-						buffer.read_uint32(&msg_count);
-
-						char seed[16];
-						buffer.read(16, &seed);
-
-						std::string enc = buffer.get_remaining();
+				return;
+			}
+			else if (type == 0x85)
+			{
+				uint32_t msg_count;
+				char seed[16];
+				if (!buffer.read_uint32(&msg_count) || !buffer.read(16, &seed)) return;
 
-						char hash[8];
-						std::memcpy(hash, &(enc.data()[enc.size() - 8]), 8);
+				const auto enc = buffer.get_remaining();
+				if (enc.size() < 8) return;
 
-						std::string dec = utils::cryptography::aes::decrypt(
-							std::string(enc.data(), enc.size() - 8), std::string(seed, 16),
-							demonware::get_decrypt_key());
+				std::string dec;
+				dec.resize(enc.size() - 8);
 
-						byte_buffer serv(dec);
-						serv.set_use_data_types(false);
+				if (!this->keys_.get_decrypt_context().decrypt(
+					reinterpret_cast<const uint8_t*>(enc.data()), dec.size(),
+					reinterpret_cast<const uint8_t*>(seed), reinterpret_cast<uint8_t*>(dec.data())))
+				{
+					return;
+				}
 
-						uint32_t serv_size;
-						serv.read_uint32(&serv_size);
+				byte_buffer serv(std::move(dec));
+				serv.set_use_data_types(false);
 
-						uint8_t magic; // 0x86
-						serv.read_byte(&magic);
+				uint32_t serv_size;
+				serv.read_uint32(&serv_size);
 
-						uint8_t service_id;
-						serv.read_byte(&service_id);
+				uint8_t magic; // 0x86
+				serv.read_byte(&magic);
 
-						this->call_service(service_id, serv.get_remaining());
+				uint8_t service_id;
+				serv.read_byte(&service_id);
 
-						return;
-					}
-				}
+				serv.set_use_data_types(true);
+				this->call_service(service_id, &serv);
 
-				printf("[DW]: [lobby]: ERROR! received unk message.\n");
 				return;
 			}
 		}
-		catch (...)
-		{
-		}
+
+		printf("[DW]: [lobby]: ERROR! received unk message.\n");
 	}
 
-	void lobby_server::call_service(const uint8_t id, const std::string& data)
+	void lobby_server::call_service(const uint8_t id, byte_buffer* data)
 	{
 		const auto& it = this->services_.find(id);
 
-		if (it != this->services_.end())
-		{
-			it->second->exec_task(this, data);
-		}
-		else
+		if (it == this->services_.end())
 		{
 			printf("[DW]: [lobby]: missing service '%s'\n", utils::string::va("%d", id));
 
 			// return no error
-			byte_buffer buffer(data);
 			uint8_t task_id;
-			buffer.read_byte(&task_id);
+			data->read_byte(&task_id);
 
 			this->create_reply(task_id)->send();
+			return;
 		}
+
+		if (!trace::is_enabled())
+		{
+			it->second->exec_task(this, data);
+			return;
+		}
+
+		// Only copy the payload when it is going to be written out
+		const auto payload = trace::is_recording() ? data->get_remaining() : std::string{};
+
+		const auto start = std::chrono::steady_clock::now();
+		it->second->exec_task(this, data);
+		const auto latency = std::chrono::steady_clock::now() - start;
+
+		trace::record(id, it->second->task_id(), payload, latency);
 	}
 }
@@ -3,6 +3,8 @@
 #include "tcp_server.hpp"
 #include "service_server.hpp"
 #include "../service.hpp"
+#include "../keys.hpp"
+#include "../frame_assembler.hpp"
 
 namespace demonware
 {
@@ -23,11 +25,19 @@ namespace demonware
 		}
 
 		void send_reply(reply* data) override;
+		session_keys& get_keys() override;
 
 	private:
+		// Larger frames are treated as a broken stream
+		static constexpr int max_frame_size = 0x1000000;
+
 		std::unordered_map<uint8_t, std::unique_ptr<service>> services_;
+		session_keys keys_;
+		frame_assembler frames_;
 
 		void handle(const std::string& packet) override;
-		void call_service(uint8_t id, const std::string& data);
+		void handle_client_header(std::string_view packet);
+		void handle_frame(std::string_view packet);
+		void call_service(uint8_t id, byte_buffer* data);
 	};
 }
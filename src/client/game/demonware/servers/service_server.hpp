@@ -23,5 +23,6 @@ namespace demonware
 		}
 
 		virtual void send_reply(reply* data) = 0;
+		virtual session_keys& get_keys() = 0;
 	};
 }
@@ -2,18 +2,20 @@
 #include "stun_server.hpp"
 
 #include "../byte_buffer.hpp"
+#include "../byte_reader.hpp"
 
 namespace demonware
 {
-	void stun_server::handle(const endpoint_data& endpoint, const std::string& packet)
+	void stun_server::handle(const endpoint_data& endpoint, const std::string_view packet)
 	{
 		uint8_t type, version, padding;
 
-		byte_buffer buffer(packet);
+		byte_reader buffer(packet);
 		buffer.set_use_data_types(false);
-		buffer.read_byte(&type);
-		buffer.read_byte(&version);
-		buffer.read_byte(&padding);
+		if (!buffer.read_byte(&type) || !buffer.read_byte(&version) || !buffer.read_byte(&padding))
+		{
+			return;
+		}
 
 		switch (type)
 		{
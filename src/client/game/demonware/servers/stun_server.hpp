@@ -10,7 +10,7 @@ namespace demonware
 		using udp_server::udp_server;
 
 	private:
-		void handle(const endpoint_data& endpoint, const std::string& packet) override;
+		void handle(const endpoint_data& endpoint, std::string_view packet) override;
 
 		void ip_discovery(const endpoint_data& endpoint);
 		void nat_discovery(const endpoint_data& endpoint);
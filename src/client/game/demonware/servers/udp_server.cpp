@@ -3,101 +3,183 @@
 
 namespace demonware
 {
+	namespace
+	{
+		// Enough to absorb a burst without holding on to memory forever
+		constexpr size_t max_pooled_packets = 256;
+	}
+
 	void udp_server::handle_input(const char* buf, size_t size, endpoint_data endpoint)
 	{
-		in_queue_.access([&](in_queue& queue)
-		{
-			in_packet p;
-			p.data = std::string{buf, size};
-			p.endpoint = std::move(endpoint);
+		auto packet = this->acquire_packet(buf, size, endpoint);
 
-			queue.emplace(std::move(p));
+		this->in_queue_.access([&](std::vector<packet_ptr>& queue)
+		{
+			queue.emplace_back(std::move(packet));
 		});
 	}
 
 	size_t udp_server::handle_output(SOCKET socket, char* buf, size_t size, sockaddr* address, int* addrlen)
 	{
-		return out_queue_.access<size_t>([&](socket_queue_map& map) -> size_t
+		auto* queue = this->find_out_queue(socket);
+		if (!queue || !queue->pending)
 		{
-			const auto entry = map.find(socket);
-			if (entry == map.end())
-			{
-				return 0;
-			}
+			return 0;
+		}
 
-			auto& queue = entry->second;
+		packet_ptr packet;
 
-			if (queue.empty())
+		{
+			std::lock_guard _{queue->mutex};
+			if (queue->packets.empty())
 			{
 				return 0;
 			}
 
-			auto data = std::move(queue.front());
-			queue.pop();
+			packet = std::move(queue->packets.front());
+			queue->packets.pop();
+			queue->pending = !queue->packets.empty();
+		}
 
-			const auto copy_size = std::min(size, data.data.size());
-			std::memcpy(buf, data.data.data(), copy_size);
-			std::memcpy(address, &data.address, sizeof(data.address));
-			*addrlen = sizeof(data.address);
+		const auto copy_size = std::min(size, packet->data.size());
+		std::memcpy(buf, packet->data.data(), copy_size);
+		std::memcpy(address, &packet->endpoint.address, sizeof(packet->endpoint.address));
+		*addrlen = sizeof(packet->endpoint.address);
 
-			return copy_size;
-		});
+		this->release_packet(std::move(packet));
+		return copy_size;
 	}
 
 	bool udp_server::pending_data(SOCKET socket)
 	{
-		return this->out_queue_.access<bool>([&](const socket_queue_map& map)
+		const auto* queue = this->find_out_queue(socket);
+		return queue && queue->pending;
+	}
+
+	void udp_server::send(const endpoint_data& endpoint, const std::string_view data)
+	{
+		auto packet = this->acquire_packet(data.data(), data.size(), endpoint);
+		auto& queue = this->get_out_queue(endpoint.socket);
+
+		std::lock_guard _{queue.mutex};
+		queue.packets.emplace(std::move(packet));
+		queue.pending = true;
+	}
+
+	void udp_server::frame()
+	{
+		if (this->in_queue_.get_raw().empty())
 		{
-			const auto entry = map.find(socket);
-			if (entry == map.end())
-			{
-				return false;
-			}
+			return;
+		}
 
-			return !entry->second.empty();
+		// Take everything that arrived since the last frame in one go
+		this->in_queue_.access([&](std::vector<packet_ptr>& queue)
+		{
+			this->in_batch_.swap(queue);
 		});
+
+		for (const auto& packet : this->in_batch_)
+		{
+			this->handle(packet->endpoint, std::string_view(packet->data.data(), packet->data.size()));
+		}
+
+		this->release_packets(this->in_batch_);
 	}
 
-	void udp_server::send(const endpoint_data& endpoint, std::string data)
+	udp_server::packet_ptr udp_server::acquire_packet(const char* buf, const size_t size,
+	                                                  const endpoint_data& endpoint)
 	{
-		out_queue_.access([&](socket_queue_map& map)
+		auto packet = this->packet_pool_.access<packet_ptr>([](std::vector<packet_ptr>& pool) -> packet_ptr
 		{
-			out_packet p;
-			p.data = std::move(data);
-			p.address = endpoint.address;
+			if (pool.empty())
+			{
+				return {};
+			}
 
-			map[endpoint.socket].emplace(std::move(p));
+			auto entry = std::move(pool.back());
+			pool.pop_back();
+			return entry;
 		});
+
+		if (!packet)
+		{
+			packet = std::make_unique<udp_server::packet>();
+			packet->data.reserve(pooled_packet_size);
+		}
+
+		packet->data.assign(buf, buf + size);
+		packet->endpoint = endpoint;
+
+		return packet;
 	}
 
-	void udp_server::frame()
+	void udp_server::release_packet(packet_ptr packet)
 	{
-		if (this->in_queue_.get_raw().empty())
+		// Buffers grown by an oversized datagram aren't worth keeping around
+		if (packet->data.capacity() > pooled_packet_size)
 		{
 			return;
 		}
 
-		while (true)
+		this->packet_pool_.access([&](std::vector<packet_ptr>& pool)
 		{
-			in_packet packet{};
-			const auto result = this->in_queue_.access<bool>([&](in_queue& queue)
+			if (pool.size() < max_pooled_packets)
 			{
-				if (queue.empty())
+				pool.emplace_back(std::move(packet));
+			}
+		});
+	}
+
+	void udp_server::release_packets(std::vector<packet_ptr>& packets)
+	{
+		this->packet_pool_.access([&](std::vector<packet_ptr>& pool)
+		{
+			for (auto& packet : packets)
+			{
+				if (pool.size() >= max_pooled_packets)
 				{
-					return false;
+					break;
 				}
 
-				packet = std::move(queue.front());
-				queue.pop();
-				return true;
-			});
-
-			if (!result)
-			{
-				break;
+				if (packet->data.capacity() <= pooled_packet_size)
+				{
+					pool.emplace_back(std::move(packet));
+				}
 			}
+		});
 
-			this->handle(packet.endpoint, std::move(packet.data));
+		packets.clear();
+	}
+
+	udp_server::socket_queue* udp_server::find_out_queue(const SOCKET socket)
+	{
+		std::shared_lock _{this->out_queues_mutex_};
+
+		const auto entry = this->out_queues_.find(socket);
+		if (entry == this->out_queues_.end())
+		{
+			return nullptr;
+		}
+
+		return entry->second.get();
+	}
+
+	udp_server::socket_queue& udp_server::get_out_queue(const SOCKET socket)
+	{
+		if (auto* queue = this->find_out_queue(socket))
+		{
+			return *queue;
+		}
+
+		std::unique_lock _{this->out_queues_mutex_};
+
+		auto& queue = this->out_queues_[socket];
+		if (!queue)
+		{
+			queue = std::make_unique<socket_queue>();
 		}
+
+		return *queue;
 	}
 }
@@ -27,6 +27,9 @@ namespace demonware
 			}
 		};
 
+		// Pooled buffers keep this much capacity, larger datagrams get a buffer of their own
+		static constexpr size_t pooled_packet_size = 0x800;
+
 		using base_server::base_server;
 
 		void handle_input(const char* buf, size_t size, endpoint_data endpoint);
@@ -36,27 +39,37 @@ namespace demonware
 		void frame() override;
 
 	protected:
-		virtual void handle(const endpoint_data& endpoint, const std::string& data) = 0;
-		void send(const endpoint_data& endpoint, std::string data);
+		virtual void handle(const endpoint_data& endpoint, std::string_view data) = 0;
+		void send(const endpoint_data& endpoint, std::string_view data);
 
 	private:
-		struct in_packet
+		struct packet
 		{
-			std::string data;
+			std::vector<char> data;
 			endpoint_data endpoint;
 		};
 
-		struct out_packet
+		using packet_ptr = std::unique_ptr<packet>;
+
+		struct socket_queue
 		{
-			std::string data;
-			sockaddr_in address;
+			std::mutex mutex;
+			std::queue<packet_ptr> packets;
+			std::atomic_bool pending{false};
 		};
 
-		using in_queue = std::queue<in_packet>;
-		using out_queue = std::queue<out_packet>;
-		using socket_queue_map = std::unordered_map<SOCKET, out_queue>;
+		utils::concurrency::container<std::vector<packet_ptr>> packet_pool_;
+		utils::concurrency::container<std::vector<packet_ptr>> in_queue_;
+		std::vector<packet_ptr> in_batch_;
+
+		std::shared_mutex out_queues_mutex_;
+		std::unordered_map<SOCKET, std::unique_ptr<socket_queue>> out_queues_;
+
+		packet_ptr acquire_packet(const char* buf, size_t size, const endpoint_data& endpoint);
+		void release_packet(packet_ptr packet);
+		void release_packets(std::vector<packet_ptr>& packets);
 
-		utils::concurrency::container<in_queue> in_queue_;
-		utils::concurrency::container<socket_queue_map> out_queue_;
+		socket_queue* find_out_queue(SOCKET socket);
+		socket_queue& get_out_queue(SOCKET socket);
 	};
 }
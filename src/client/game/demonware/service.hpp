@@ -39,13 +39,11 @@ namespace demonware
 			return this->task_id_;
 		}
 
-		virtual void exec_task(service_server* server, const std::string& data)
+		virtual void exec_task(service_server* server, byte_buffer* buffer)
 		{
 			std::lock_guard<std::mutex> _(this->mutex_);
 
-			byte_buffer buffer(data);
-
-			buffer.read_byte(&this->task_id_);
+			buffer->read_byte(&this->task_id_);
 
 			const auto& it = this->tasks_.find(this->task_id_);
 
@@ -55,7 +53,7 @@ namespace demonware
 				printf("[DW] %s: executing task '%d'\n", name_.data(), this->task_id_);
 #endif
 
-				it->second(server, &buffer);
+				it->second(server, buffer);
 			}
 			else
 			{
@@ -16,7 +16,7 @@ namespace demonware
 	{
 	}
 
-	void bdBandwidthTest::exec_task(service_server* server, const std::string& data)
+	void bdBandwidthTest::exec_task(service_server* server, byte_buffer* /*data*/)
 	{
 		byte_buffer buffer;
 		buffer.write(sizeof bandwidth_iw6, bandwidth_iw6);
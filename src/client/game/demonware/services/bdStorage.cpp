@@ -1,13 +1,11 @@
 #include <std_include.hpp>
 #include "../services.hpp"
+#include "../user_storage.hpp"
+#include "../error_codes.hpp"
+#include "../platform.hpp"
 
-#include <utils/nt.hpp>
-#include <utils/io.hpp>
 #include <utils/cryptography.hpp>
 
-#include "game/game.hpp"
-#include "component/motd.hpp"
-
 namespace demonware
 {
 	bdStorage::bdStorage() : service(10, "bdStorage")
@@ -18,63 +16,134 @@ namespace demonware
 		this->register_task(12, &bdStorage::get_user_file);
 		this->register_task(13, &bdStorage::unk13);
 
-		this->map_publisher_resource_variant(".*\\motd-.*\\.txt", motd::get_text);
-		this->map_publisher_resource("ffotd-.*\\.ff", DW_FASTFILE);
-		this->map_publisher_resource("playlists(_.+)?\\.aggr", DW_PLAYLISTS);
-		this->map_publisher_resource("social_[Tt][Uu][0-9]+\\.cfg", DW_SOCIAL_CONFIG);
-		this->map_publisher_resource("mm\\.cfg", DW_MM_CONFIG);
-		this->map_publisher_resource("entitlement_config\\.info", DW_ENTITLEMENT_CONFIG);
-		this->map_publisher_resource("lootConfig_[Tt][Uu][0-9]+\\.csv", DW_LOOT_CONFIG);
-		this->map_publisher_resource("winStoreConfig_[Tt][Uu][0-9]+\\.csv", DW_STORE_CONFIG);
+		this->map_publisher_resource_variant({"motd-", ".txt", name_rule::any, true}, platform::get_motd);
+		this->map_publisher_resource({"ffotd-", ".ff", name_rule::any}, DW_FASTFILE);
+		this->map_publisher_resource({"playlists", ".aggr", name_rule::tagged}, DW_PLAYLISTS);
+		this->map_publisher_resource({"social_", ".cfg", name_rule::title_update}, DW_SOCIAL_CONFIG);
+		this->map_publisher_resource({"mm", ".cfg", name_rule::none}, DW_MM_CONFIG);
+		this->map_publisher_resource({"entitlement_config", ".info", name_rule::none}, DW_ENTITLEMENT_CONFIG);
+		this->map_publisher_resource({"lootConfig_", ".csv", name_rule::title_update}, DW_LOOT_CONFIG);
+		this->map_publisher_resource({"winStoreConfig_", ".csv", name_rule::title_update}, DW_STORE_CONFIG);
+	}
+
+	bool bdStorage::resource_pattern::match(const std::string_view name) const
+	{
+		if (name.size() < this->prefix.size() + this->suffix.size() || !name.ends_with(this->suffix))
+		{
+			return false;
+		}
+
+		auto middle = name.substr(0, name.size() - this->suffix.size());
+
+		if (this->floating_prefix)
+		{
+			const auto pos = middle.find(this->prefix);
+			if (pos == std::string_view::npos)
+			{
+				return false;
+			}
+
+			middle.remove_prefix(pos + this->prefix.size());
+		}
+		else
+		{
+			if (!middle.starts_with(this->prefix))
+			{
+				return false;
+			}
+
+			middle.remove_prefix(this->prefix.size());
+		}
+
+		switch (this->rule)
+		{
+		case name_rule::none:
+			return middle.empty();
+		case name_rule::any:
+			return true;
+		case name_rule::tagged:
+			return middle.empty() || (middle.size() > 1 && middle[0] == '_');
+		case name_rule::title_update:
+			return middle.size() > 2 && (middle[0] | 0x20) == 't' && (middle[1] | 0x20) == 'u'
+				&& std::all_of(middle.begin() + 2, middle.end(), [](const char c)
+				{
+					return c >= '0' && c <= '9';
+				});
+		}
+
+		return false;
 	}
 
-	void bdStorage::map_publisher_resource(const std::string& expression, const INT id)
+	void bdStorage::map_publisher_resource(resource_pattern pattern, const int id)
 	{
-		auto data = utils::nt::load_resource(id);
-		this->map_publisher_resource_variant(expression, std::move(data));
+		auto data = std::make_shared<const std::string>(platform::load_resource(id));
+		this->map_publisher_resource_variant(std::move(pattern), std::move(data));
 	}
 
-	void bdStorage::map_publisher_resource_variant(const std::string& expression, resource_variant resource)
+	void bdStorage::map_publisher_resource_variant(resource_pattern pattern, resource_variant resource)
 	{
 		if (resource.valueless_by_exception())
 		{
 			throw std::runtime_error("Publisher resource variant is empty!");
 		}
 
-		this->publisher_resources_.emplace_back(std::regex{expression}, std::move(resource));
+		this->publisher_resources_.emplace_back(std::move(pattern), std::move(resource));
+		this->publisher_resource_cache_.clear();
 	}
 
-	bool bdStorage::load_publisher_resource(const std::string& name, std::string& buffer)
+	const bdStorage::resource_variant* bdStorage::find_publisher_resource(const std::string& name)
 	{
+		const auto cached = this->publisher_resource_cache_.find(name);
+		if (cached != this->publisher_resource_cache_.end())
+		{
+			return cached->second;
+		}
+
+		const resource_variant* result = nullptr;
 		for (const auto& resource : this->publisher_resources_)
 		{
-			if (std::regex_match(name, resource.first))
+			if (resource.first.match(name))
 			{
-				if (std::holds_alternative<std::string>(resource.second))
-				{
-					buffer = std::get<std::string>(resource.second);
-				}
-				else
-				{
-					buffer = std::get<callback>(resource.second)();
-				}
+				result = &resource.second;
+				break;
+			}
+		}
+
+		// File names are picked by the game, but don't let a misbehaving client grow this forever
+		if (this->publisher_resource_cache_.size() >= 256)
+		{
+			this->publisher_resource_cache_.clear();
+		}
+
+		this->publisher_resource_cache_.emplace(name, result);
+		return result;
+	}
 
-				return true;
+	bdStorage::payload bdStorage::load_publisher_resource(const std::string& name)
+	{
+		const auto* resource = this->find_publisher_resource(name);
+		if (resource)
+		{
+			if (std::holds_alternative<payload>(*resource))
+			{
+				return std::get<payload>(*resource);
 			}
+
+			return std::make_shared<const std::string>(std::get<callback>(*resource)());
 		}
 
 #ifdef DEBUG
 		printf("[DW]: [bdStorage]: missing publisher file: %s\n", name.data());
 #endif
 
-		return false;
+		return {};
 	}
 
 	void bdStorage::list_publisher_files(service_server* server, byte_buffer* buffer)
 	{
 		uint32_t date;
 		uint16_t num_results, offset;
-		std::string filename, data;
+		std::string filename;
 
 		buffer->read_uint32(&date);
 		buffer->read_uint16(&num_results);
@@ -83,7 +152,7 @@ namespace demonware
 
 		auto reply = server->create_reply(this->task_id());
 
-		if (this->load_publisher_resource(filename, data))
+		if (const auto data = this->load_publisher_resource(filename))
 		{
 			auto* info = new bdFileInfo;
 
@@ -91,7 +160,7 @@ namespace demonware
 			info->filename = filename;
 			info->create_time = 0;
 			info->modified_time = info->create_time;
-			info->file_size = uint32_t(data.size());
+			info->file_size = uint32_t(data->size());
 			info->owner_id = 0;
 			info->priv = false;
 
@@ -110,12 +179,10 @@ namespace demonware
 		printf("[DW]: [bdStorage]: loading publisher file: %s\n", filename.data());
 #endif
 
-		std::string data;
-
-		if (this->load_publisher_resource(filename, data))
+		if (const auto data = this->load_publisher_resource(filename))
 		{
 #ifdef DEBUG
-			printf("[DW]: [bdStorage]: sending publisher file: %s, size: %lld\n", filename.data(), data.size());
+			printf("[DW]: [bdStorage]: sending publisher file: %s, size: %lld\n", filename.data(), data->size());
 #endif
 
 			auto reply = server->create_reply(this->task_id());
@@ -124,7 +191,7 @@ namespace demonware
 		}
 		else
 		{
-			server->create_reply(this->task_id(), game::BD_NO_FILE)->send();
+			server->create_reply(this->task_id(), BD_NO_FILE)->send();
 		}
 	}
 
@@ -145,8 +212,8 @@ namespace demonware
 		buffer->read_blob(&data);
 		buffer->read_uint64(&owner);
 
-		const auto path = get_user_file_path(filename);
-		utils::io::write_file(path, data);
+		const auto size = data.size();
+		user_storage::write(get_user_file_path(filename), std::move(data));
 
 		auto* info = new bdFileInfo;
 
@@ -154,7 +221,7 @@ namespace demonware
 		info->filename = filename;
 		info->create_time = uint32_t(time(nullptr));
 		info->modified_time = info->create_time;
-		info->file_size = uint32_t(data.size());
+		info->file_size = uint32_t(size);
 		info->owner_id = owner;
 		info->priv = priv;
 
@@ -166,7 +233,7 @@ namespace demonware
 	void bdStorage::get_user_file(service_server* server, byte_buffer* buffer) const
 	{
 		uint64_t owner{};
-		std::string game, filename, platform, data;
+		std::string game, filename, platform;
 
 		buffer->read_string(&game);
 		buffer->read_string(&filename);
@@ -177,8 +244,7 @@ namespace demonware
 		printf("[DW]: [bdStorage]: user file: %s, %s, %s\n", game.data(), filename.data(), platform.data());
 #endif
 
-		const auto path = get_user_file_path(filename);
-		if (utils::io::read_file(path, &data))
+		if (const auto data = user_storage::read(get_user_file_path(filename)))
 		{
 			auto reply = server->create_reply(this->task_id());
 			reply->add(new bdFileData(data));
@@ -186,7 +252,7 @@ namespace demonware
 		}
 		else
 		{
-			server->create_reply(this->task_id(), game::BD_NO_FILE)->send();
+			server->create_reply(this->task_id(), BD_NO_FILE)->send();
 		}
 	}
 
@@ -8,13 +8,36 @@ namespace demonware
 		bdStorage();
 
 	private:
+		using payload = std::shared_ptr<const std::string>;
 		using callback = std::function<std::string()>;
-		using resource_variant = std::variant<std::string, callback>;
-		std::vector<std::pair<std::regex, resource_variant>> publisher_resources_;
+		using resource_variant = std::variant<payload, callback>;
 
-		void map_publisher_resource(const std::string& expression, INT id);
-		void map_publisher_resource_variant(const std::string& expression, resource_variant resource);
-		bool load_publisher_resource(const std::string& name, std::string& buffer);
+		// Constraint on the part of a file name between prefix and suffix
+		enum class name_rule
+		{
+			none, // nothing
+			any, // .*
+			tagged, // (_.+)?
+			title_update, // [Tt][Uu][0-9]+
+		};
+
+		struct resource_pattern
+		{
+			std::string prefix;
+			std::string suffix;
+			name_rule rule;
+			bool floating_prefix = false; // prefix may be preceded by anything
+
+			bool match(std::string_view name) const;
+		};
+
+		std::vector<std::pair<resource_pattern, resource_variant>> publisher_resources_;
+		std::unordered_map<std::string, const resource_variant*> publisher_resource_cache_;
+
+		void map_publisher_resource(resource_pattern pattern, int id);
+		void map_publisher_resource_variant(resource_pattern pattern, resource_variant resource);
+		const resource_variant* find_publisher_resource(const std::string& name);
+		payload load_publisher_resource(const std::string& name);
 
 		void list_publisher_files(service_server* server, byte_buffer* buffer);
 		void get_publisher_file(service_server* server, byte_buffer* buffer);
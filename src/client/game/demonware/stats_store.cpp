@@ -0,0 +1,359 @@
+#include <std_include.hpp>
+#include "stats_store.hpp"
+
+#include <utils/cryptography.hpp>
+#include <utils/io.hpp>
+#include <utils/thread.hpp>
+
+namespace demonware
+{
+	namespace
+	{
+		constexpr uint32_t record_magic = 0x54415453; // 'STAT'
+
+		// Writes arriving within this window share one fsync
+		constexpr auto coalesce_window = 250ms;
+
+		// Rewrite the log on load once most of it is superseded rows
+		constexpr size_t compaction_threshold = 0x10000;
+
+		struct record_header
+		{
+			uint32_t magic;
+			uint32_t leaderboard_id;
+			uint64_t entity_id;
+			int64_t rating;
+			uint32_t data_size;
+			uint32_t checksum;
+		};
+
+		static_assert(sizeof(record_header) == 32);
+
+		uint32_t compute_checksum(record_header header, const std::string_view data)
+		{
+			header.checksum = 0;
+
+			std::string buffer(reinterpret_cast<const char*>(&header), sizeof(header));
+			buffer.append(data);
+
+			return utils::cryptography::jenkins_one_at_a_time::compute(buffer);
+		}
+
+		void append_record(std::string& log, const stats_store::row& row)
+		{
+			record_header header{};
+			header.magic = record_magic;
+			header.leaderboard_id = row.leaderboard_id;
+			header.entity_id = row.entity_id;
+			header.rating = row.rating;
+			header.data_size = static_cast<uint32_t>(row.data.size());
+			header.checksum = compute_checksum(header, row.data);
+
+			log.append(reinterpret_cast<const char*>(&header), sizeof(header));
+			log.append(row.data);
+		}
+	}
+
+	stats_store::stats_store(std::string path) : path_(std::move(path))
+	{
+		this->load();
+		this->writer_thread_ = utils::thread::create_named_thread("Demonware stats", [this]
+		{
+			this->writer_main();
+		});
+	}
+
+	stats_store::~stats_store()
+	{
+		{
+			std::lock_guard _(this->writer_mutex_);
+			this->stopping_ = true;
+		}
+
+		this->work_cv_.notify_all();
+
+		if (this->writer_thread_.joinable())
+		{
+			this->writer_thread_.join();
+		}
+	}
+
+	void stats_store::write(const std::vector<row>& rows)
+	{
+		std::string log;
+		for (const auto& row : rows)
+		{
+			append_record(log, row);
+		}
+
+		{
+			std::unique_lock _(this->mutex_);
+			for (const auto& row : rows)
+			{
+				this->apply(row);
+			}
+
+			// Queued while memory is still locked, so the log replays writes in the order they were applied
+			std::lock_guard writer_lock(this->writer_mutex_);
+			this->pending_.append(log);
+		}
+
+		this->work_cv_.notify_one();
+	}
+
+	std::vector<stats_store::ranked_row> stats_store::read_by_entities(const uint32_t leaderboard_id,
+	                                                                   const std::vector<uint64_t>& entity_ids)
+	{
+		std::shared_lock _(this->mutex_);
+
+		const auto board = this->leaderboards_.find(leaderboard_id);
+		if (board == this->leaderboards_.end())
+		{
+			return {};
+		}
+
+		std::vector<ranked_row> result;
+		result.reserve(entity_ids.size());
+
+		for (const auto entity_id : entity_ids)
+		{
+			const auto entry = board->second.rows.find(entity_id);
+			if (entry == board->second.rows.end())
+			{
+				continue;
+			}
+
+			const auto rank = board->second.index.rank({entry->second.rating, entity_id});
+			result.push_back({{leaderboard_id, entity_id, entry->second.rating, entry->second.data}, rank + 1});
+		}
+
+		return result;
+	}
+
+	std::vector<stats_store::ranked_row> stats_store::read_by_rank(const uint32_t leaderboard_id,
+	                                                               const uint64_t first_rank, const size_t count)
+	{
+		std::shared_lock _(this->mutex_);
+
+		const auto board = this->leaderboards_.find(leaderboard_id);
+		if (board == this->leaderboards_.end() || first_rank == 0)
+		{
+			return {};
+		}
+
+		return this->read_range(board->second, leaderboard_id, static_cast<size_t>(first_rank - 1), count);
+	}
+
+	std::vector<stats_store::ranked_row> stats_store::read_by_rating(const uint32_t leaderboard_id,
+	                                                                 const int64_t rating, const size_t count)
+	{
+		std::shared_lock _(this->mutex_);
+
+		const auto board = this->leaderboards_.find(leaderboard_id);
+		if (board == this->leaderboards_.end())
+		{
+			return {};
+		}
+
+		// Entity 0 sorts first among equal ratings
+		const auto first = board->second.index.rank({rating, 0});
+		return this->read_range(board->second, leaderboard_id, first, count);
+	}
+
+	std::vector<stats_store::ranked_row> stats_store::read_around(const uint32_t leaderboard_id,
+	                                                              const uint64_t entity_id, const size_t count)
+	{
+		std::shared_lock _(this->mutex_);
+
+		const auto board = this->leaderboards_.find(leaderboard_id);
+		if (board == this->leaderboards_.end())
+		{
+			return {};
+		}
+
+		const auto entry = board->second.rows.find(entity_id);
+		if (entry == board->second.rows.end())
+		{
+			return {};
+		}
+
+		const auto size = board->second.index.size();
+		const auto rank = board->second.index.rank({entry->second.rating, entity_id});
+
+		// Shift the window instead of shrinking it near either end
+		auto first = rank - std::min(rank, count / 2);
+		if (count < size)
+		{
+			first = std::min(first, size - count);
+		}
+		else
+		{
+			first = 0;
+		}
+
+		return this->read_range(board->second, leaderboard_id, first, count);
+	}
+
+	size_t stats_store::size(const uint32_t leaderboard_id)
+	{
+		std::shared_lock _(this->mutex_);
+
+		const auto board = this->leaderboards_.find(leaderboard_id);
+		return board == this->leaderboards_.end() ? 0 : board->second.index.size();
+	}
+
+	void stats_store::flush()
+	{
+		std::unique_lock lock(this->writer_mutex_);
+
+		this->flush_requested_ = true;
+		this->work_cv_.notify_one();
+
+		this->idle_cv_.wait(lock, [this]
+		{
+			return this->pending_.empty() && !this->writing_;
+		});
+	}
+
+	void stats_store::load()
+	{
+		size_t record_count = 0;
+		size_t valid_size = 0;
+		size_t file_size = 0;
+
+		{
+			const utils::io::mapped_file file(this->path_);
+			const auto data = file.get_data();
+			file_size = data.size();
+
+			while (data.size() - valid_size >= sizeof(record_header))
+			{
+				record_header header{};
+				std::memcpy(&header, data.data() + valid_size, sizeof(header));
+
+				const auto payload_offset = valid_size + sizeof(header);
+				if (header.magic != record_magic || header.data_size > data.size() - payload_offset)
+				{
+					break;
+				}
+
+				const auto payload = data.substr(payload_offset, header.data_size);
+				if (compute_checksum(header, payload) != header.checksum)
+				{
+					break;
+				}
+
+				this->apply({header.leaderboard_id, header.entity_id, header.rating, std::string(payload)});
+
+				valid_size = payload_offset + header.data_size;
+				++record_count;
+			}
+		}
+
+		size_t live_rows = 0;
+		for (const auto& board : this->leaderboards_)
+		{
+			live_rows += board.second.rows.size();
+		}
+
+		// Rewrite if the tail is torn or most records are stale, appending after garbage would lose them
+		const auto torn = valid_size != file_size;
+		const auto stale = record_count > compaction_threshold && record_count > live_rows * 2;
+		if (!torn && !stale)
+		{
+			return;
+		}
+
+		std::string log;
+		for (const auto& [leaderboard_id, board] : this->leaderboards_)
+		{
+			for (const auto& [entity_id, row] : board.rows)
+			{
+				append_record(log, {leaderboard_id, entity_id, row.rating, row.data});
+			}
+		}
+
+		if (!utils::io::write_file_atomic(this->path_, log))
+		{
+			printf("[DW]: [stats]: failed to compact %s\n", this->path_.data());
+		}
+	}
+
+	void stats_store::apply(const row& row)
+	{
+		auto& board = this->leaderboards_[row.leaderboard_id];
+
+		const auto [entry, inserted] = board.rows.try_emplace(row.entity_id);
+		if (!inserted)
+		{
+			board.index.erase({entry->second.rating, row.entity_id});
+		}
+
+		entry->second.rating = row.rating;
+		entry->second.data = row.data;
+		board.index.insert({row.rating, row.entity_id});
+	}
+
+	std::vector<stats_store::ranked_row> stats_store::read_range(const leaderboard& board,
+	                                                             const uint32_t leaderboard_id, const size_t first,
+	                                                             const size_t count) const
+	{
+		std::vector<ranked_row> result;
+
+		const auto size = board.index.size();
+		for (auto rank = first; rank < size && result.size() < count; ++rank)
+		{
+			const auto entry = board.index.at(rank);
+			const auto& stored = board.rows.at(entry.entity_id);
+			result.push_back({{leaderboard_id, entry.entity_id, entry.rating, stored.data}, rank + 1});
+		}
+
+		return result;
+	}
+
+	void stats_store::writer_main()
+	{
+		std::unique_lock lock(this->writer_mutex_);
+
+		while (true)
+		{
+			this->work_cv_.wait(lock, [this]
+			{
+				return this->stopping_ || this->flush_requested_ || !this->pending_.empty();
+			});
+
+			if (!this->stopping_ && !this->flush_requested_)
+			{
+				this->work_cv_.wait_for(lock, coalesce_window, [this]
+				{
+					return this->stopping_ || this->flush_requested_;
+				});
+			}
+
+			this->flush_requested_ = false;
+
+			if (this->pending_.empty())
+			{
+				this->idle_cv_.notify_all();
+				if (this->stopping_) break;
+				continue;
+			}
+
+			std::string batch;
+			batch.swap(this->pending_);
+			this->writing_ = true;
+
+			lock.unlock();
+
+			if (!utils::io::append_file_durable(this->path_, batch))
+			{
+				printf("[DW]: [stats]: failed to write %s\n", this->path_.data());
+			}
+
+			lock.lock();
+
+			this->writing_ = false;
+			this->idle_cv_.notify_all();
+		}
+	}
+}
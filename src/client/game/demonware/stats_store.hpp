@@ -0,0 +1,84 @@
+#pragma once
+
+#include "ranked_index.hpp"
+
+namespace demonware
+{
+	// Leaderboards kept in memory and persisted to an append-only log.
+	// The log is read through a mapping and replayed on load, writes show up
+	// immediately and are appended and fsynced in batches off-thread.
+	class stats_store final
+	{
+	public:
+		struct row
+		{
+			uint32_t leaderboard_id;
+			uint64_t entity_id;
+			int64_t rating;
+			std::string data;
+		};
+
+		struct ranked_row
+		{
+			row value;
+			uint64_t rank; // Starts at 1
+		};
+
+		explicit stats_store(std::string path);
+		~stats_store();
+
+		stats_store(stats_store&&) = delete;
+		stats_store(const stats_store&) = delete;
+		stats_store& operator=(stats_store&&) = delete;
+		stats_store& operator=(const stats_store&) = delete;
+
+		void write(const std::vector<row>& rows);
+
+		std::vector<ranked_row> read_by_entities(uint32_t leaderboard_id, const std::vector<uint64_t>& entity_ids);
+		std::vector<ranked_row> read_by_rank(uint32_t leaderboard_id, uint64_t first_rank, size_t count);
+		std::vector<ranked_row> read_by_rating(uint32_t leaderboard_id, int64_t rating, size_t count);
+
+		// Rows centered on the entity, or nothing if it has no row
+		std::vector<ranked_row> read_around(uint32_t leaderboard_id, uint64_t entity_id, size_t count);
+
+		size_t size(uint32_t leaderboard_id);
+
+		// Blocks until every write so far has been synced to disk
+		void flush();
+
+	private:
+		struct stored_row
+		{
+			int64_t rating;
+			std::string data;
+		};
+
+		struct leaderboard
+		{
+			std::unordered_map<uint64_t, stored_row> rows;
+			ranked_index index;
+		};
+
+		std::string path_;
+
+		std::shared_mutex mutex_;
+		std::unordered_map<uint32_t, leaderboard> leaderboards_;
+
+		// Taken inside mutex_ by writes, never the other way round
+		std::mutex writer_mutex_;
+		std::condition_variable work_cv_;
+		std::condition_variable idle_cv_;
+		std::string pending_;
+		bool writing_ = false;
+		bool flush_requested_ = false;
+		bool stopping_ = false;
+		std::thread writer_thread_;
+
+		void load();
+		void apply(const row& row);
+		std::vector<ranked_row> read_range(const leaderboard& board, uint32_t leaderboard_id, size_t first,
+		                                   size_t count) const;
+
+		void writer_main();
+	};
+}
@@ -0,0 +1,274 @@
+#include <std_include.hpp>
+#include "trace.hpp"
+
+#include <utils/io.hpp>
+#include <utils/string.hpp>
+
+namespace demonware::trace
+{
+	namespace
+	{
+		constexpr char trace_magic[4] = {'D', 'W', 'T', 'R'};
+		constexpr uint32_t trace_version = 1;
+
+		// Each power of two is split into 8 buckets, keeping percentiles within 12.5%
+		constexpr size_t sub_bucket_bits = 3;
+		constexpr size_t sub_bucket_count = 1 << sub_bucket_bits;
+		constexpr size_t bucket_count = 40 * sub_bucket_count;
+
+		// timestamp, latency, service, task, payload size
+		constexpr size_t record_header_size = 8 + 8 + 1 + 1 + 4;
+
+		size_t get_bucket(const uint64_t value)
+		{
+			if (value < sub_bucket_count)
+			{
+				return static_cast<size_t>(value);
+			}
+
+			const auto shift = static_cast<size_t>(std::bit_width(value)) - 1 - sub_bucket_bits;
+			const auto sub_bucket = static_cast<size_t>(value >> shift) & (sub_bucket_count - 1);
+			const auto bucket = (shift + 1) * sub_bucket_count + sub_bucket;
+			return std::min(bucket, bucket_count - 1);
+		}
+
+		uint64_t get_bucket_limit(const size_t bucket)
+		{
+			if (bucket < sub_bucket_count)
+			{
+				return bucket;
+			}
+
+			const auto shift = bucket / sub_bucket_count - 1;
+			const auto lower = (sub_bucket_count + bucket % sub_bucket_count) << shift;
+			return lower + (uint64_t(1) << shift) - 1;
+		}
+
+		struct histogram
+		{
+			std::array<uint64_t, bucket_count> buckets{};
+			uint64_t count = 0;
+			uint64_t total = 0;
+			uint64_t max = 0;
+
+			void add(const uint64_t latency)
+			{
+				++this->buckets[get_bucket(latency)];
+				++this->count;
+				this->total += latency;
+				this->max = std::max(this->max, latency);
+			}
+
+			// Upper limit of the bucket holding the percentile
+			uint64_t percentile(const double p) const
+			{
+				const auto target = std::max(static_cast<uint64_t>(std::ceil(p * static_cast<double>(this->count))),
+				                             uint64_t(1));
+
+				uint64_t seen = 0;
+				for (size_t i = 0; i < bucket_count; ++i)
+				{
+					seen += this->buckets[i];
+					if (seen >= target)
+					{
+						return std::min(get_bucket_limit(i), this->max);
+					}
+				}
+
+				return this->max;
+			}
+		};
+
+		std::atomic_bool enabled{false};
+		std::atomic_bool recording{false};
+
+		std::mutex mutex;
+		std::map<uint16_t, histogram> histograms;
+		std::ofstream trace_file;
+		std::chrono::steady_clock::time_point trace_start;
+
+		template <typename T>
+		void write_value(std::string& buffer, const T& value)
+		{
+			buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+		}
+
+		template <typename T>
+		T read_value(const std::string& buffer, const size_t offset)
+		{
+			T value{};
+			std::memcpy(&value, buffer.data() + offset, sizeof(value));
+			return value;
+		}
+
+		double to_microseconds(const uint64_t nanoseconds)
+		{
+			return static_cast<double>(nanoseconds) / 1000.0;
+		}
+	}
+
+	bool start(const std::string& path)
+	{
+		std::lock_guard<std::mutex> _(mutex);
+
+		if (trace_file.is_open())
+		{
+			trace_file.close();
+		}
+
+		recording = false;
+
+		if (!path.empty())
+		{
+			trace_file.open(path, std::ios::binary | std::ios::trunc);
+			if (!trace_file.is_open())
+			{
+				enabled = false;
+				return false;
+			}
+
+			std::string header(trace_magic, sizeof(trace_magic));
+			write_value(header, trace_version);
+			trace_file.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+			trace_start = std::chrono::steady_clock::now();
+			recording = true;
+		}
+
+		enabled = true;
+		return true;
+	}
+
+	void stop()
+	{
+		std::lock_guard<std::mutex> _(mutex);
+
+		enabled = false;
+		recording = false;
+
+		if (trace_file.is_open())
+		{
+			trace_file.close();
+		}
+	}
+
+	bool is_enabled()
+	{
+		return enabled;
+	}
+
+	bool is_recording()
+	{
+		return recording;
+	}
+
+	void record(const uint8_t service, const uint8_t task, const std::string& payload,
+	            const std::chrono::nanoseconds latency)
+	{
+		const auto nanoseconds = static_cast<uint64_t>(std::max<int64_t>(latency.count(), 0));
+
+		std::lock_guard<std::mutex> _(mutex);
+
+		if (!enabled)
+		{
+			return;
+		}
+
+		histograms[static_cast<uint16_t>((service << 8) | task)].add(nanoseconds);
+
+		if (!recording)
+		{
+			return;
+		}
+
+		const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - trace_start).count();
+
+		std::string buffer;
+		buffer.reserve(record_header_size + payload.size());
+
+		write_value(buffer, static_cast<uint64_t>(timestamp));
+		write_value(buffer, nanoseconds);
+		write_value(buffer, service);
+		write_value(buffer, task);
+		write_value(buffer, static_cast<uint32_t>(payload.size()));
+		buffer.append(payload);
+
+		trace_file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	}
+
+	std::vector<std::string> format_histograms()
+	{
+		std::vector<std::string> lines;
+		lines.emplace_back(utils::string::va("%-8s %-5s %10s %10s %10s %10s %10s %10s", "service", "task", "calls",
+		                                     "mean us", "p50 us", "p90 us", "p99 us", "max us"));
+
+		std::lock_guard<std::mutex> _(mutex);
+
+		for (const auto& [key, histogram] : histograms)
+		{
+			const auto mean = histogram.total / std::max(histogram.count, uint64_t(1));
+
+			lines.emplace_back(utils::string::va("%-8u %-5u %10llu %10.1f %10.1f %10.1f %10.1f %10.1f", key >> 8,
+			                                     key & 0xFF, static_cast<unsigned long long>(histogram.count),
+			                                     to_microseconds(mean),
+			                                     to_microseconds(histogram.percentile(0.5)),
+			                                     to_microseconds(histogram.percentile(0.9)),
+			                                     to_microseconds(histogram.percentile(0.99)),
+			                                     to_microseconds(histogram.max)));
+		}
+
+		return lines;
+	}
+
+	void reset_histograms()
+	{
+		std::lock_guard<std::mutex> _(mutex);
+		histograms.clear();
+	}
+
+	std::vector<call> load(const std::string& path)
+	{
+		std::string data;
+		if (!utils::io::read_file(path, &data))
+		{
+			throw std::runtime_error("Failed to read trace " + path);
+		}
+
+		constexpr auto file_header_size = sizeof(trace_magic) + sizeof(trace_version);
+
+		if (data.size() < file_header_size || std::memcmp(data.data(), trace_magic, sizeof(trace_magic))
+			|| read_value<uint32_t>(data, sizeof(trace_magic)) != trace_version)
+		{
+			throw std::runtime_error("Invalid trace " + path);
+		}
+
+		std::vector<call> calls;
+		size_t offset = file_header_size;
+
+		// A trace cut short by a crash simply ends at the last complete record
+		while (data.size() - offset >= record_header_size)
+		{
+			call entry{};
+			entry.timestamp = read_value<uint64_t>(data, offset);
+			entry.latency = read_value<uint64_t>(data, offset + 8);
+			entry.service = read_value<uint8_t>(data, offset + 16);
+			entry.task = read_value<uint8_t>(data, offset + 17);
+
+			const auto payload_size = read_value<uint32_t>(data, offset + 18);
+			offset += record_header_size;
+
+			if (data.size() - offset < payload_size)
+			{
+				break;
+			}
+
+			entry.payload = data.substr(offset, payload_size);
+			offset += payload_size;
+
+			calls.emplace_back(std::move(entry));
+		}
+
+		return calls;
+	}
+}
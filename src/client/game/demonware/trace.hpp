@@ -0,0 +1,30 @@
+#pragma once
+
+namespace demonware::trace
+{
+	struct call
+	{
+		uint64_t timestamp; // Nanoseconds since recording started
+		uint64_t latency; // Nanoseconds spent in the handler
+		uint8_t service;
+		uint8_t task;
+
+		// Decrypted service data, starting with the typed task id
+		std::string payload;
+	};
+
+	// Starts timing service calls. With a path, calls are also appended to a trace file.
+	bool start(const std::string& path = {});
+	void stop();
+
+	bool is_enabled();
+	bool is_recording();
+
+	void record(uint8_t service, uint8_t task, const std::string& payload, std::chrono::nanoseconds latency);
+
+	// One line per service and task with counts and latency percentiles
+	std::vector<std::string> format_histograms();
+	void reset_histograms();
+
+	std::vector<call> load(const std::string& path);
+}
@@ -0,0 +1,277 @@
+#include <std_include.hpp>
+#include "user_storage.hpp"
+
+#include <utils/io.hpp>
+#include <utils/thread.hpp>
+
+namespace demonware::user_storage
+{
+	namespace
+	{
+		// Writes arriving within this window are merged into one disk write
+		constexpr auto coalesce_window = 250ms;
+
+		// Rough cost of a cache entry besides its contents
+		constexpr size_t entry_overhead = 128;
+
+		struct entry
+		{
+			payload data{};
+			bool dirty = false;
+			bool writing = false;
+			std::list<std::string>::iterator lru{};
+			size_t cost = 0;
+		};
+
+		std::mutex mutex;
+		std::condition_variable work_cv;
+		std::condition_variable idle_cv;
+
+		std::unordered_map<std::string, entry> files;
+		std::vector<std::string> pending;
+
+		// Batches are numbered, pending files go into the one after the last started
+		uint64_t started_batches = 0;
+		uint64_t written_batches = 0;
+
+		// Most recently used first, only clean files are ever evicted
+		std::list<std::string> lru;
+		size_t cache_limit = 64 * 1024 * 1024;
+		size_t cached_bytes = 0;
+		uint64_t disk_writes = 0;
+
+		bool flush_requested = false;
+		bool stopping = false;
+		bool writer_running = false;
+		std::thread writer_thread;
+
+		entry& get_entry(const std::string& path)
+		{
+			const auto [file, inserted] = files.try_emplace(path);
+			if (inserted)
+			{
+				lru.push_front(path);
+				file->second.lru = lru.begin();
+			}
+			else
+			{
+				lru.splice(lru.begin(), lru, file->second.lru);
+			}
+
+			return file->second;
+		}
+
+		void set_data(entry& file, const std::string& path, payload data)
+		{
+			cached_bytes -= file.cost;
+			file.cost = data->size() + path.size() + entry_overhead;
+			cached_bytes += file.cost;
+			file.data = std::move(data);
+		}
+
+		void trim_cache()
+		{
+			for (auto path = lru.end(); cached_bytes > cache_limit && path != lru.begin();)
+			{
+				--path;
+
+				const auto file = files.find(*path);
+				if (file->second.dirty || file->second.writing)
+				{
+					continue;
+				}
+
+				cached_bytes -= file->second.cost;
+				files.erase(file);
+				path = lru.erase(path);
+			}
+		}
+
+		void writer_main()
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+
+			while (true)
+			{
+				work_cv.wait(lock, []
+				{
+					return stopping || !pending.empty();
+				});
+
+				if (pending.empty())
+				{
+					break;
+				}
+
+				if (!stopping && !flush_requested)
+				{
+					work_cv.wait_for(lock, coalesce_window, []
+					{
+						return stopping || flush_requested;
+					});
+				}
+
+				flush_requested = false;
+
+				std::vector<std::pair<std::string, payload>> batch;
+				batch.reserve(pending.size());
+
+				for (auto& path : pending)
+				{
+					auto& file = files.at(path);
+					file.dirty = false;
+					file.writing = true;
+					batch.emplace_back(std::move(path), file.data);
+				}
+
+				pending.clear();
+				++started_batches;
+
+				lock.unlock();
+
+				for (const auto& [path, data] : batch)
+				{
+					if (!utils::io::write_file_atomic(path, *data))
+					{
+						printf("[DW]: [storage]: failed to write user file: %s\n", path.data());
+					}
+				}
+
+				lock.lock();
+
+				for (const auto& [path, data] : batch)
+				{
+					files.at(path).writing = false;
+				}
+
+				disk_writes += batch.size();
+				trim_cache();
+
+				written_batches = started_batches;
+				idle_cv.notify_all();
+			}
+
+			writer_running = false;
+			idle_cv.notify_all();
+		}
+
+		void start_writer()
+		{
+			if (!writer_running)
+			{
+				writer_running = true;
+				writer_thread = utils::thread::create_named_thread("Demonware storage", writer_main);
+			}
+		}
+	}
+
+	payload read(const std::string& path)
+	{
+		{
+			std::lock_guard<std::mutex> _(mutex);
+			const auto file = files.find(path);
+			if (file != files.end())
+			{
+				lru.splice(lru.begin(), lru, file->second.lru);
+				return file->second.data;
+			}
+		}
+
+		std::string data;
+		if (!utils::io::read_file(path, &data))
+		{
+			return {};
+		}
+
+		std::lock_guard<std::mutex> _(mutex);
+
+		// A write may have raced the disk read, it always wins
+		auto& file = get_entry(path);
+		if (!file.data)
+		{
+			set_data(file, path, std::make_shared<const std::string>(std::move(data)));
+		}
+
+		auto result = file.data;
+		trim_cache();
+
+		return result;
+	}
+
+	void write(const std::string& path, std::string data)
+	{
+		auto contents = std::make_shared<const std::string>(std::move(data));
+
+		std::lock_guard<std::mutex> _(mutex);
+
+		auto& file = get_entry(path);
+		set_data(file, path, std::move(contents));
+
+		if (stopping && !writer_running)
+		{
+			// Too late for the background writer
+			utils::io::write_file_atomic(path, *file.data);
+			++disk_writes;
+			trim_cache();
+			return;
+		}
+
+		if (!file.dirty)
+		{
+			file.dirty = true;
+			pending.emplace_back(path);
+		}
+
+		start_writer();
+		work_cv.notify_one();
+	}
+
+	void flush()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		if (!writer_running)
+		{
+			return;
+		}
+
+		// Waits for the batches holding what was written so far, not for an idle writer,
+		// which a steady stream of writes may never leave it
+		const auto target = started_batches + (pending.empty() ? 0 : 1);
+
+		flush_requested = true;
+		work_cv.notify_one();
+
+		idle_cv.wait(lock, [target]
+		{
+			return written_batches >= target || !writer_running;
+		});
+	}
+
+	void set_cache_limit(const size_t bytes)
+	{
+		std::lock_guard<std::mutex> _(mutex);
+		cache_limit = bytes;
+		trim_cache();
+	}
+
+	cache_stats get_cache_stats()
+	{
+		std::lock_guard<std::mutex> _(mutex);
+		return {files.size(), cached_bytes, disk_writes};
+	}
+
+	void shutdown()
+	{
+		{
+			std::lock_guard<std::mutex> _(mutex);
+			stopping = true;
+		}
+
+		work_cv.notify_one();
+
+		if (writer_thread.joinable())
+		{
+			writer_thread.join();
+		}
+	}
+}
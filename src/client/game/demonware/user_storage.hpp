@@ -0,0 +1,31 @@
+#pragma once
+
+namespace demonware::user_storage
+{
+	using payload = std::shared_ptr<const std::string>;
+
+	// Returns the cached contents, loading them from disk on first access
+	payload read(const std::string& path);
+
+	// Updates the cache and queues the file for a write-behind flush.
+	// Repeated writes to the same file before it is flushed are coalesced.
+	void write(const std::string& path, std::string data);
+
+	// Blocks until every write made before the call has reached the disk
+	void flush();
+
+	struct cache_stats
+	{
+		size_t files;
+		size_t bytes;
+		uint64_t disk_writes;
+	};
+
+	// Least recently used files are dropped once the cache grows past the limit.
+	// Files still waiting for the writer stay cached regardless.
+	void set_cache_limit(size_t bytes);
+	cache_stats get_cache_stats();
+
+	// Flushes and stops the writer thread
+	void shutdown();
+}
@@ -16,15 +16,23 @@ namespace scripting
 			return value_ptr;
 		}
 
-		void push_value(const script_value& value)
+		void push_value(const game::VariableValue& value)
 		{
 			auto* value_ptr = allocate_argument();
-			*value_ptr = value.get_raw();
+			*value_ptr = value;
 
 			game::AddRefToValue(value_ptr->type, value_ptr->u);
 		}
 
-		int get_field_id(const int classnum, const std::string& field)
+		void push_value(const script_value& value)
+		{
+			push_value(value.get_raw());
+		}
+
+		// Resolved ids per class, fields that don't exist are cached as -1
+		std::vector<std::unordered_map<std::string, int>> field_ids;
+
+		int find_field_id(const int classnum, const std::string& field)
 		{
 			const auto class_id = game::g_classMap[classnum].id;
 			const auto field_str = game::SL_GetString(field.data(), 0);
@@ -44,6 +52,26 @@ namespace scripting
 			return -1;
 		}
 
+		int get_field_id(const int classnum, const std::string& field)
+		{
+			if (static_cast<size_t>(classnum) >= field_ids.size())
+			{
+				field_ids.resize(classnum + 1);
+			}
+
+			auto& ids = field_ids[classnum];
+
+			const auto entry = ids.find(field);
+			if (entry != ids.end())
+			{
+				return entry->second;
+			}
+
+			const auto id = find_field_id(classnum, field);
+			ids.emplace(field, id);
+			return id;
+		}
+
 		script_value get_return_value()
 		{
 			if (game::scr_VmPub->inparamcount == 0)
@@ -57,6 +85,75 @@ namespace scripting
 
 			return script_value(game::scr_VmPub->top[1 - game::scr_VmPub->outparamcount]);
 		}
+
+		bool is_method_call(const game::scr_entref_t& entref)
+		{
+			return *reinterpret_cast<const int*>(&entref) != -1;
+		}
+
+		template <typename Arguments>
+		script_value execute_function(const script_function function, const std::string_view name,
+		                              const game::scr_entref_t& entref, const Arguments& arguments)
+		{
+			const auto is_method = is_method_call(entref);
+			if (function == nullptr)
+			{
+				throw std::runtime_error(
+					"Unknown "s + (is_method ? "method" : "function") + " '" + std::string(name) + "'");
+			}
+
+			stack_isolation _;
+
+			for (auto i = arguments.size(); i > 0; --i)
+			{
+				push_value(arguments[i - 1]);
+			}
+
+			game::scr_VmPub->outparamcount = game::scr_VmPub->inparamcount;
+			game::scr_VmPub->inparamcount = 0;
+
+			if (!safe_execution::call(function, entref))
+			{
+				throw std::runtime_error(
+					"Error executing "s + (is_method ? "method" : "function") + " '" + std::string(name) + "'");
+			}
+
+			return get_return_value();
+		}
+	}
+
+	argument_buffer::~argument_buffer()
+	{
+		for (size_t i = 0; i < this->size_; ++i)
+		{
+			const auto& value = (*this)[i];
+			game::RemoveRefToValue(value.type, value.u);
+		}
+	}
+
+	void argument_buffer::push(const game::VariableValue& value)
+	{
+		if (this->size_ < inline_capacity)
+		{
+			this->values_[this->size_] = value;
+		}
+		else
+		{
+			this->overflow_.push_back(value);
+		}
+
+		++this->size_;
+		game::AddRefToValue(value.type, value.u);
+	}
+
+	size_t argument_buffer::size() const
+	{
+		return this->size_;
+	}
+
+	const game::VariableValue& argument_buffer::operator[](const size_t index) const
+	{
+		return index < inline_capacity ? this->values_[index] : this->overflow_[index - inline_capacity];
 	}
 
 	void notify(const entity& entity, const std::string& event, const std::vector<script_value>& arguments)
@@ -75,31 +172,35 @@ namespace scripting
 	                           const std::vector<script_value>& arguments)
 	{
 		const auto entref = entity.get_entity_reference();
+		const auto function = find_function(name, !is_method_call(entref));
 
-		const auto is_method_call = *reinterpret_cast<const int*>(&entref) != -1;
-		const auto function = find_function(name, !is_method_call);
-		if (function == nullptr)
-		{
-			throw std::runtime_error("Unknown "s + (is_method_call ? "method" : "function") + " '" + name + "'");
-		}
+		return execute_function(function, name, entref, arguments);
+	}
 
-		stack_isolation _;
+	script_value call_function(const function_handle& function, const entity& entity,
+	                           const std::vector<script_value>& arguments)
+	{
+		const auto entref = entity.get_entity_reference();
+		const auto target = is_method_call(entref) ? function.method : function.function;
 
-		for (auto i = arguments.rbegin(); i != arguments.rend(); ++i)
-		{
-			push_value(*i);
-		}
+		return execute_function(target, function.name, entref, arguments);
+	}
 
-		game::scr_VmPub->outparamcount = game::scr_VmPub->inparamcount;
-		game::scr_VmPub->inparamcount = 0;
+	script_value call_function(const std::string& name, const entity& entity, const argument_buffer& arguments)
+	{
+		const auto entref = entity.get_entity_reference();
+		const auto function = find_function(name, !is_method_call(entref));
 
-		if (!safe_execution::call(function, entref))
-		{
-			throw std::runtime_error(
-				"Error executing "s + (is_method_call ? "method" : "function") + " '" + name + "'");
-		}
+		return execute_function(function, name, entref, arguments);
+	}
 
-		return get_return_value();
+	script_value call_function(const function_handle& function, const entity& entity,
+	                           const argument_buffer& arguments)
+	{
+		const auto entref = entity.get_entity_reference();
+		const auto target = is_method_call(entref) ? function.method : function.function;
+
+		return execute_function(target, function.name, entref, arguments);
 	}
 
 	script_value call_function(const std::string& name, const std::vector<script_value>& arguments)
@@ -155,45 +256,93 @@ namespace scripting
 		return exec_ent_thread(entity, pos, arguments);
 	}
 
-	static std::unordered_map<unsigned int, std::unordered_map<std::string, script_value>> custom_fields;
+	namespace
+	{
+		struct custom_field
+		{
+			unsigned int name;
+			script_value value;
+		};
+
+		// Field names are interned, each entity id gets its own small list
+		struct custom_field_storage
+		{
+			std::unordered_map<std::string, unsigned int> names;
+			std::vector<std::vector<custom_field>> entities;
+		};
+
+		custom_field_storage custom_fields;
+
+		script_value* find_custom_field(const unsigned int id, const unsigned int name)
+		{
+			if (id >= custom_fields.entities.size())
+			{
+				return nullptr;
+			}
+
+			for (auto& field : custom_fields.entities[id])
+			{
+				if (field.name == name)
+				{
+					return &field.value;
+				}
+			}
+
+			return nullptr;
+		}
+	}
 
 	script_value get_custom_field(const entity& entity, const std::string& field)
 	{
-		auto& fields = custom_fields[entity.get_entity_id()];
-		const auto _field = fields.find(field);
-		if (_field != fields.end())
+		const auto name = custom_fields.names.find(field);
+		if (name == custom_fields.names.end())
 		{
-			return _field->second;
+			return {};
 		}
-		return {};
+
+		const auto* value = find_custom_field(entity.get_entity_id(), name->second);
+		return value ? *value : script_value{};
 	}
 
 	void set_custom_field(const entity& entity, const std::string& field, const script_value& value)
 	{
 		const auto id = entity.get_entity_id();
+		const auto name = custom_fields.names.try_emplace(field, static_cast<unsigned int>(custom_fields.names.size()))
+		                                   .first->second;
 
-		if (custom_fields[id].find(field) != custom_fields[id].end())
+		if (auto* existing = find_custom_field(id, name))
 		{
-			custom_fields[id][field] = value;
+			*existing = value;
 			return;
 		}
 
-		custom_fields[id].insert(std::make_pair(field, value));
+		if (id >= custom_fields.entities.size())
+		{
+			custom_fields.entities.resize(id + 1);
+		}
+
+		custom_fields.entities[id].push_back({name, value});
 	}
 
 	void clear_entity_fields(const entity& entity)
 	{
 		const auto id = entity.get_entity_id();
 
-		if (custom_fields.find(id) != custom_fields.end())
+		// Keeps the capacity, the slot is usually reused by the next player
+		if (id < custom_fields.entities.size())
 		{
-			custom_fields[id].clear();
+			custom_fields.entities[id].clear();
 		}
 	}
 
 	void clear_custom_fields()
 	{
-		custom_fields.clear();
+		custom_fields = {};
+	}
+
+	void clear_field_id_cache()
+	{
+		field_ids.clear();
 	}
 
 	void set_entity_field(const entity& entity, const std::string& field, const script_value& value)
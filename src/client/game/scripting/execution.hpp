@@ -5,9 +5,40 @@
 
 namespace scripting
 {
+	// Arguments for a single call, stored inline for the usual argument counts.
+	// Every value holds a reference, like script_value does.
+	class argument_buffer final
+	{
+	public:
+		static constexpr size_t inline_capacity = 8;
+
+		argument_buffer() = default;
+		~argument_buffer();
+
+		argument_buffer(argument_buffer&&) = delete;
+		argument_buffer(const argument_buffer&) = delete;
+		argument_buffer& operator=(argument_buffer&&) = delete;
+		argument_buffer& operator=(const argument_buffer&) = delete;
+
+		void push(const game::VariableValue& value);
+
+		size_t size() const;
+		const game::VariableValue& operator[](size_t index) const;
+
+	private:
+		std::array<game::VariableValue, inline_capacity> values_{};
+		std::vector<game::VariableValue> overflow_{};
+		size_t size_ = 0;
+	};
+
 	script_value call_function(const std::string& name, const std::vector<script_value>& arguments);
 	script_value call_function(const std::string& name, const entity& entity,
 	                           const std::vector<script_value>& arguments);
+	script_value call_function(const function_handle& function, const entity& entity,
+	                           const std::vector<script_value>& arguments);
+	script_value call_function(const std::string& name, const entity& entity, const argument_buffer& arguments);
+	script_value call_function(const function_handle& function, const entity& entity,
+	                           const argument_buffer& arguments);
 
 	template <typename T = script_value>
 	T call(const std::string& name, const std::vector<script_value>& arguments = {});
@@ -29,6 +60,9 @@ namespace scripting
 	void clear_entity_fields(const entity& entity);
 	void clear_custom_fields();
 
+	// Field ids are only valid for the current level
+	void clear_field_id_cache();
+
 	void set_entity_field(const entity& entity, const std::string& field, const script_value& value);
 	script_value get_entity_field(const entity& entity, const std::string& field);
 
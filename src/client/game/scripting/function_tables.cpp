@@ -1,1535 +1,1584 @@
 #include <std_include.hpp>
+#include "functions.hpp"
 
 // This file has been generated.
 // Do not touch!
 
 namespace scripting
 {
-	std::unordered_map<std::string, unsigned> function_map =
+	namespace
 	{
-		{"precacheturret", 0},
-		{"getweaponarray", 1},
-		{"getnumparam", 15},
-		{"getnumparam", 16},
-		{"spawnturret", 23},
-		{"canspawnturret", 24},
-		{"assertexcmd", 25},
-		{"badplace_delete", 30},
-		{"badplace_cylinder", 31},
-		{"badplace_arc", 32},
-		{"badplace_brush", 33},
-		{"assertexcmd0", 44},
-		{"isdefined", 46},
-		{"isvalidmissile", 47},
-		{"isstring", 48},
-		{"setomnvar", 49},
-		{"getomnvar", 50},
-		{"setdvar", 51},
-		{"setdynamicdvar", 52},
-		{"setdvarifuninitialized", 53},
-		{"setdevdvar", 54},
-		{"setdevdvarifuninitialized", 55},
-		{"getdvar", 56},
-		{"getdvarint", 57},
-		{"getdvarfloat", 58},
-		{"getdvarvector", 59},
-		{"gettime", 60},
-		{"getutc", 61},
-		{"getradiometricunit", 62},
-		{"getentbynum", 63},
-		{"getweaponmodel", 64},
-		{"setsunlight", 68},
-		{"resetsunlight", 69},
-		{"getweapondisplayname", 92},
-		{"getweaponbasename", 93},
-		{"getweaponattachments", 94},
-		{"getweaponattachmentdisplaynames", 95},
-		{"getweaponcamoname", 96},
-		{"getweaponreticlename", 97},
-		{"getanimlength", 98},
-		{"animhasnotetrack", 99},
-		{"getnotetracktimes", 100},
-		{"spawn", 101},
-		{"spawnloopingsound", 103},
-		{"bullettrace", 104},
-		{"getstartorigin", 108},
-		{"getstartangles", 109},
-		{"magicgrenademanual", 112},
-		{"sub_140311ad0", 117},
-		{"sub_140311d80", 118},
-		{"sub_140311d90", 119},
-		{"sub_140311df0", 120},
-		{"sub_140311ef0", 121},
-		{"sub_140311f50", 122},
-		{"sub_14031fb60", 127},
-		{"bullettracepassed", 138},
-		{"sighttracepassed", 139},
-		{"physicstrace", 140},
-		{"playerphysicstrace", 141},
-		{"getgroundposition", 142},
-		{"getmovedelta", 143},
-		{"getangledelta", 144},
-		{"getnorthyaw", 145},
-		{"setnorthyaw", 172},
-		{"setslowmotion", 173},
-		{"randomint", 174},
-		{"randomfloat", 175},
-		{"randomintrange", 176},
-		{"randomfloatrange", 177},
-		{"sin", 178},
-		{"cos", 179},
-		{"tan", 180},
-		{"asin", 181},
-		{"acos", 182},
-		{"atan", 183},
-		{"castint", 184},
-		{"castfloat", 185},
-		{"abs", 186},
-		{"min", 187},
-		{"getnode", 191},
-		{"getnodearray", 192},
-		{"getallnodes", 193},
-		{"getnodesinradius", 194},
-		{"getnodesinradiussorted", 195},
-		{"getclosestnodeinsight", 196},
-		{"isarray", 202},
-		{"isai", 203},
-		{"getindexforluincstring", 204},
-		{"issentient", 205},
-		{"max", 221},
-		{"floor", 222},
-		{"ceil", 223},
-		{"exp", 224},
-		{"log", 225},
-		{"sqrt", 226},
-		{"squared", 227},
-		{"clamp", 228},
-		{"angleclamp360", 229},
-		{"angleclamp180", 230},
-		{"vectorfromlinetopoint", 231},
-		{"pointonsegmentnearesttopoint", 232},
-		{"distance", 233},
-		{"distance2d", 234},
-		{"distancesquared", 235},
-		{"length", 236},
-		{"length2d", 237},
-		{"lengthsquared", 238},
-		{"length2dsquared", 239},
-		{"closer", 240},
-		{"vectordot", 241},
-		{"vectorcross", 242},
-		{"axistoangles", 243},
-		{"visionsetthermal", 244},
-		{"visionsetpain", 245},
-		{"startservermigration", 246},
-		{"setac130ambience", 247},
-		{"getmapcustomfield", 248},
-		{"spawnsighttrace", 249},
-		{"incrementcounter", 250},
-		{"getcountertotal", 251},
-		{"createthreatbiasgroup", 258},
-		{"threatbiasgroupexists", 259},
-		{"getthreatbias", 260},
-		{"setthreatbias", 261},
-		{"setthreatbiasagainstall", 262},
-		{"setignoremegroup", 263},
-		{"isenemyteam", 264},
-		{"vectornormalize", 271},
-		{"vectortoangles", 272},
-		{"vectortoyaw", 273},
-		{"vectorlerp", 274},
-		{"anglestoup", 275},
-		{"anglestoright", 276},
-		{"anglestoforward", 277},
-		{"anglesdelta", 278},
-		{"combineangles", 279},
-		{"transformmove", 280},
-		{"rotatevector", 281},
-		{"rotatepointaroundvector", 282},
-		{"issubstr", 283},
-		{"isendstr", 284},
-		{"getsubstr", 285},
-		{"tolower", 286},
-		{"strtok", 287},
-		{"stricmp", 288},
-		{"ambientplay", 289},
-		{"getuavstrengthmax", 290},
-		{"getuavstrengthlevelneutral", 291},
-		{"getuavstrengthlevelshowenemyfastsweep", 292},
-		{"getuavstrengthlevelshowenemydirectional", 293},
-		{"blockteamradar", 294},
-		{"unblockteamradar", 295},
-		{"isteamradarblocked", 296},
-		{"sub_140328710", 297},
-		{"setmatchdata", 298},
-		{"getmatchdata", 299},
-		{"sendmatchdata", 300},
-		{"clearmatchdata", 301},
-		{"setmatchdatadef", 302},
-		{"setmatchclientip", 303},
-		{"setmatchdataid", 304},
-		{"setclientmatchdata", 305},
-		{"getclientmatchdata", 306},
-		{"setclientmatchdatadef", 307},
-		{"sendclientmatchdata", 308},
-		{"getbuildversion", 309},
-		{"getbuildnumber", 310},
-		{"getsystemtime", 311},
-		{"getmatchrulesdata", 312},
-		{"isusingmatchrulesdata", 313},
-		{"kickplayer", 314},
-		{"issplitscreen", 315},
-		{"setmapcenter", 316},
-		{"setgameendtime", 317},
-		{"visionsetnaked", 318},
-		{"visionsetnight", 319},
-		{"visionsetmissilecam", 320},
-		{"ambientstop", 321},
-		{"precachemodel", 322},
-		{"precacheshellshock", 323},
-		{"precacheitem", 324},
-		{"precachematerial", 325},
-		{"precachestring", 326},
-		{"precachemenu", 327},
-		{"precacherumble", 328},
-		{"precachelocationselector", 329},
-		{"precacheleaderboards", 330},
-		{"loadfx", 331},
-		{"playfx", 332},
-		{"playfxontag", 333},
-		{"stopfxontag", 334},
-		{"killfxontag", 335},
-		{"playloopedfx", 336},
-		{"spawnfx", 337},
-		{"triggerfx", 338},
-		{"playfxontagforclients", 339},
-		{"sub_1403326a0", 340},
-		{"sub_14031be80", 341},
-		{"setwinningteam", 342},
-		{"announcement", 343},
-		{"clientannouncement", 344},
-		{"setteammode", 345},
-		{"getteamscore", 346},
-		{"setteamscore", 347},
-		{"setclientnamemode", 348},
-		{"updateclientnames", 349},
-		{"getteamplayersalive", 350},
-		{"worldentnumber", 352},
-		{"obituary", 353},
-		{"positionwouldtelefrag", 354},
-		{"canspawn", 355},
-		{"getstarttime", 356},
-		{"precacheheadicon", 357},
-		{"precacheminimapicon", 358},
-		{"precachempanim", 359},
-		{"maprestart", 360},
-		{"exitlevel", 361},
-		{"addtestclient", 362},
-		{"addagent", 363},
-		{"allclientsprint", 365},
-		{"clientprint", 366},
-		{"mapexists", 367},
-		{"isvalidgametype", 368},
-		{"setplayerteamrank", 370},
-		{"setteamradar", 372},
-		{"getteamradar", 373},
-		{"setteamradarstrength", 374},
-		{"getteamradarstrength", 375},
-		{"getuavstrengthmin", 376},
-		{"physicsexplosionsphere", 377},
-		{"physicsexplosioncylinder", 378},
-		{"physicsradiusjolt", 379},
-		{"physicsradiusjitter", 380},
-		{"setexpfog", 381},
-		{"setexpfogext", 382},
-		{"setexpfogdvarsonly", 383},
-		{"setexpfogextdvarsonly", 384},
-		{"setatmosfog", 385},
-		{"setatmosfogdvarsonly", 386},
-		{"isexplosivedamagemod", 387},
-		{"radiusdamage", 388},
-		{"setplayerignoreradiusdamage", 389},
-		{"glassradiusdamage", 390},
-		{"earthquake", 391},
-		{"getnumparts", 392},
-		{"objective_onentity", 393},
-		{"objective_onentitywithrotation", 394},
-		{"objective_team", 395},
-		{"objective_player", 396},
-		{"objective_playerteam", 397},
-		{"objective_playerenemyteam", 398},
-		{"objective_playermask_hidefromall", 399},
-		{"objective_playermask_hidefrom", 400},
-		{"objective_playermask_showtoall", 401},
-		{"objective_playermask_showto", 402},
-		{"iprintln", 403},
-		{"iprintlnbold", 404},
-		{"getent", 406},
-		{"getentarray", 407},
-		{"getspawnarray", 408},
-		{"spawnplane", 409},
-		{"addstruct", 410},
-		{"spawnhelicopter", 411},
-		{"isalive", 412},
-		{"isspawner", 413},
-		{"missilecreateattractorent", 414},
-		{"missilecreateattractororigin", 415},
-		{"missilecreaterepulsorent", 416},
-		{"missilecreaterepulsororigin", 417},
-		{"missiledeleteattractor", 418},
-		{"playsoundatpos", 419},
-		{"newhudelem", 420},
-		{"newclienthudelem", 421},
-		{"newteamhudelem", 422},
-		{"resettimeout", 423},
-		{"isplayer", 424},
-		{"isplayernumber", 425},
-		{"getpartname", 426},
-		{"weaponfiretime", 427},
-		{"weaponclipsize", 428},
-		{"weaponisauto", 429},
-		{"weaponissemiauto", 430},
-		{"weaponisboltaction", 431},
-		{"weaponinheritsperks", 432},
-		{"weaponburstcount", 433},
-		{"weapontype", 434},
-		{"weaponclass", 435},
-		{"getnextarraykey", 436},
-		{"sortbydistance", 437},
-		{"tablelookup", 438},
-		{"tablelookupbyrow", 439},
-		{"tablelookupistring", 440},
-		{"tablelookupistringbyrow", 441},
-		{"tablelookuprownum", 442},
-		{"tableexists", 443},
-		{"getmissileowner", 444},
-		{"magicbullet", 445},
-		{"getweaponflashtagname", 446},
-		{"averagepoint", 447},
-		{"averagenormal", 448},
-		{"getspawnerarray", 449},
-		{"playrumbleonposition", 450},
-		{"playrumblelooponposition", 451},
-		{"stopallrumbles", 452},
-		{"soundexists", 453},
-		{"setminimap", 460},
-		{"setthermalbodymaterial", 461},
-		{"getarraykeys", 462},
-		{"getfirstarraykey", 463},
-		{"getglass", 464},
-		{"getglassarray", 465},
-		{"getglassorigin", 466},
-		{"isglassdestroyed", 467},
-		{"destroyglass", 468},
-		{"deleteglass", 469},
-		{"getentchannelscount", 470},
-		{"getentchannelname", 471},
-		{"objective_add", 472},
-		{"objective_delete", 473},
-		{"objective_state", 474},
-		{"objective_icon", 475},
-		{"objective_position", 476},
-		{"objective_current", 477},
-		{"weaponinventorytype", 478},
-		{"weaponstartammo", 479},
-		{"weaponmaxammo", 480},
-		{"weaponaltweaponname", 481},
-		{"isweaponcliponly", 482},
-		{"sub_14030dfc0", 483},
-		{"sub_14030e400", 484},
-		{"weaponhasthermalscope", 485},
-		{"getvehiclenode", 486},
-		{"getvehiclenodearray", 487},
-		{"getallvehiclenodes", 488},
-		{"getactivecount", 489},
-		{"precache", 490},
-		{"spawnvehicle", 491},
-		{"getarray", 492},
-		{"pow", 493},
-		{"atan2", 494},
-		{"botgetmemoryevents", 495},
-		{"botautoconnectenabled", 496},
-		{"botzonegetcount", 497},
-		{"botzonesetteam", 498},
-		{"botzonenearestcount", 499},
-		{"botmemoryflags", 500},
-		{"botflagmemoryevents", 501},
-		{"botzonegetindoorpercent", 502},
-		{"botsentientswap", 503},
-		{"isbot", 504},
-		{"isagent", 505},
-		{"getmaxagents", 506},
-		{"botgetclosestnavigablepoint", 508},
-		{"getnodesintrigger", 509},
-		{"nodesvisible", 510},
-		{"getnodesonpath", 511},
-		{"getzonecount", 512},
-		{"getzonenearest", 513},
-		{"getzonenodes", 514},
-		{"getzonepath", 515},
-		{"getzoneorigin", 516},
-		{"getnodezone", 517},
-		{"getzonenodesbydist", 518},
-		{"getzonenodeforindex", 519},
-		{"getweaponexplosionradius", 520},
-		{"nodeexposedtosky", 523},
-		{"findentrances", 524},
-		{"badplace_global", 525},
-		{"getpathdist", 526},
-		{"getlinkednodes", 527},
-		{"disconnectnodepair", 528},
-		{"connectnodepair", 529},
-		{"precachesound", 533},
-		{"distance2dsquared", 543},
-		{"getangledelta3d", 544},
-		{"activateclientexploder", 545},
-		{"trajectorycalculateinitialvelocity", 546},
-		{"trajectorycalculateminimumvelocity", 547},
-		{"trajectorycalculateexitangle", 548},
-		{"trajectoryestimatedesiredinairtime", 549},
-		{"trajectorycomputedeltaheightattime", 550},
-		{"trajectorycanattemptaccuratejump", 551},
-		{"ispointinvolume", 553},
-		{"getscriptablearray", 560},
-		{"clearfog", 561},
-		{"setleveldopplerpreset", 562},
-		{"isusinghdr", 564},
-		{"sub_140321c40", 565},
-		{"sub_140311a40", 567},
-		{"sub_14030ec50", 568},
-		{"sub_14030f050", 569},
-		{"sub_14030f340", 570},
-		{"sub_14030f550", 571},
-		{"sub_14030f710", 572},
-		{"sub_1403295e0", 573},
-		{"sub_140322690", 574},
-		{"sub_140329600", 575},
-		{"sub_14031a690", 580},
-		{"sub_1403163c0", 581},
-		{"anglestoaxis", 582},
-		{"invertangles", 587},
-		{"rotatevectorinverted", 588},
-		{"calculatestartorientation", 589},
-		{"droptoground", 590},
-		{"precachelaser", 592},
-		{"getcsplinecount", 593},
-		{"getcsplinepointcount", 594},
-		{"getcsplinelength", 595},
-		{"getcsplinepointid", 596},
-		{"getcsplinepointlabel", 597},
-		{"getcsplinepointtension", 598},
-		{"getcsplinepointposition", 599},
-		{"getcsplinepointcorridordims", 600},
-		{"getcsplinepointtangent", 601},
-		{"getcsplinepointdisttonextpoint", 602},
-		{"calccsplineposition", 603},
-		{"calccsplinetangent", 604},
-		{"calccsplinecorridor", 605},
-		{"setnojipscore", 606},
-		{"setnojiptime", 607},
-		{"getpredictedentityposition", 608},
-		{"queuedialog", 615},
-		{"triggerportableradarping", 622},
-		{"botgetteamlimit", 624},
-		{"spawnfxforclient", 625},
-		{"botgetteamdifficulty", 626},
-		{"loadluifile", 632},
-		{"isdedicatedserver", 633},
-		{"getplaylistversion", 634},
-		{"getplaylistid", 635},
-		{"getactiveclientcount", 636},
-		{"issquadsmode", 637},
-		{"visionsetpostapply", 639},
-		{"addbot", 640},
-		{"sub_140310ec0", 641},
-		{"sub_14031bae0", 642},
-		{"sub_14031c2b0", 643},
-		{"isalliedsentient", 644},
-		{"istestclient", 645},
-		{"sub_1402d2850", 646},
-		{"sub_140311ff0", 648},
-		{"sub_140312040", 649},
-		{"sub_140311100", 651},
-		{"sub_140314c70", 652},
-		{"sub_14030d340", 653},
-		{"sub_14030da60", 654},
-		{"sub_14030e5c0", 655},
-		{"sub_14031fda0", 657},
-		{"sub_140317140", 658},
-		{"isremovedentity", 659},
-		{"tablegetrowcount", 660},
-		{"tablegetcolumncount", 661},
-		{"batteryusepershot", 662},
-		{"batteryreqtouse", 663},
-		{"sub_14030e700", 664},
-		{"getentityweaponname", 666},
-		{"sub_14031fc20", 667},
-		{"deployriotshield", 668},
-		{"validatecostume", 669},
-		{"randomcostume", 670},
-		{"shootblank", 671},
-		{"debugstringtostring", 673},
-		{"sub_140319680", 675},
-		{"playcinematicforall", 679},
-		{"preloadcinematicforall", 680},
-		{"stopcinematicforall", 681},
-		{"capsuletracepassed", 682},
-		{"sub_14031ca40", 683},
-		{"sub_14031e1f0", 684},
-		{"sub_140321880", 685},
-		{"lootservicestarttrackingplaytime", 687},
-		{"sub_1403297b0", 688},
-		{"lootservicevalidateplaytime", 689},
-		{"recordbreadcrumbdataforplayer", 690},
-		{"sub_140317df0", 691},
-		{"sysprint", 693},
-		{"sub_140337920", 694},
-		{"sub_140321ae0", 697},
-		{"isonlinegame", 698},
-		{"issystemlink", 699},
-		{"getstanceandmotionstateforplayer", 701},
-		{"sub_1402d3540", 702},
-		{"sub_1402d35b0", 703},
-		{"sub_140332a70", 704},
-		{"sub_140332ae0", 705},
-		{"getplaylistname", 706},
-		{"getlocaltime", 707},
-		{"sub_14032c820", 708},
-		{"getchallengeid", 710},
-		{"nodegetremotemissilename", 711},
-		{"nodehasremotemissileset", 712},
-		{"remotemissileenttracetooriginpassed", 713},
-		{"bombingruntracepassed", 714},
-		{"handlepickupdeployedriotshield", 716},
-		{"sub_14032c6b0", 717},
-		{"getcostumefromtable", 718},
-		{"sub_1402d3460", 720},
-		{"getchallenerewarditem", 722},
-		{"setentplayerxuidforemblem", 723},
-		{"resetentplayerxuidforemblems", 724},
-		{"nodesetremotemissilename", 725},
-		{"sub_14031aa80", 726},
-		{"sub_14031ead0", 727},
-		{"iszombie", 728},
-		{"sub_14031b670", 729},
-		{"sub_14031d3f0", 730},
-		{"sub_14031e670", 731},
-		{"getactiveplayerlist", 732},
-		{"sub_140319200", 733},
-		{"sub_140331e00", 734},
-	};
+		constexpr std::pair<std::string_view, unsigned> function_entries[] =
+		{
+			{"abs", 186},
+			{"acos", 182},
+			{"activateclientexploder", 545},
+			{"addagent", 363},
+			{"addbot", 640},
+			{"addstruct", 410},
+			{"addtestclient", 362},
+			{"allclientsprint", 365},
+			{"ambientplay", 289},
+			{"ambientstop", 321},
+			{"angleclamp180", 230},
+			{"angleclamp360", 229},
+			{"anglesdelta", 278},
+			{"anglestoaxis", 582},
+			{"anglestoforward", 277},
+			{"anglestoright", 276},
+			{"anglestoup", 275},
+			{"animhasnotetrack", 99},
+			{"announcement", 343},
+			{"asin", 181},
+			{"assertexcmd", 25},
+			{"assertexcmd0", 44},
+			{"atan", 183},
+			{"atan2", 494},
+			{"averagenormal", 448},
+			{"averagepoint", 447},
+			{"axistoangles", 243},
+			{"badplace_arc", 32},
+			{"badplace_brush", 33},
+			{"badplace_cylinder", 31},
+			{"badplace_delete", 30},
+			{"badplace_global", 525},
+			{"batteryreqtouse", 663},
+			{"batteryusepershot", 662},
+			{"blockteamradar", 294},
+			{"bombingruntracepassed", 714},
+			{"botautoconnectenabled", 496},
+			{"botflagmemoryevents", 501},
+			{"botgetclosestnavigablepoint", 508},
+			{"botgetmemoryevents", 495},
+			{"botgetteamdifficulty", 626},
+			{"botgetteamlimit", 624},
+			{"botmemoryflags", 500},
+			{"botsentientswap", 503},
+			{"botzonegetcount", 497},
+			{"botzonegetindoorpercent", 502},
+			{"botzonenearestcount", 499},
+			{"botzonesetteam", 498},
+			{"bullettrace", 104},
+			{"bullettracepassed", 138},
+			{"calccsplinecorridor", 605},
+			{"calccsplineposition", 603},
+			{"calccsplinetangent", 604},
+			{"calculatestartorientation", 589},
+			{"canspawn", 355},
+			{"canspawnturret", 24},
+			{"capsuletracepassed", 682},
+			{"castfloat", 185},
+			{"castint", 184},
+			{"ceil", 223},
+			{"clamp", 228},
+			{"clearfog", 561},
+			{"clearmatchdata", 301},
+			{"clientannouncement", 344},
+			{"clientprint", 366},
+			{"closer", 240},
+			{"combineangles", 279},
+			{"connectnodepair", 529},
+			{"cos", 179},
+			{"createthreatbiasgroup", 258},
+			{"debugstringtostring", 673},
+			{"deleteglass", 469},
+			{"deployriotshield", 668},
+			{"destroyglass", 468},
+			{"disconnectnodepair", 528},
+			{"distance", 233},
+			{"distance2d", 234},
+			{"distance2dsquared", 543},
+			{"distancesquared", 235},
+			{"droptoground", 590},
+			{"earthquake", 391},
+			{"exitlevel", 361},
+			{"exp", 224},
+			{"findentrances", 524},
+			{"floor", 222},
+			{"getactiveclientcount", 636},
+			{"getactivecount", 489},
+			{"getactiveplayerlist", 732},
+			{"getallnodes", 193},
+			{"getallvehiclenodes", 488},
+			{"getangledelta", 144},
+			{"getangledelta3d", 544},
+			{"getanimlength", 98},
+			{"getarray", 492},
+			{"getarraykeys", 462},
+			{"getbuildnumber", 310},
+			{"getbuildversion", 309},
+			{"getchallenerewarditem", 722},
+			{"getchallengeid", 710},
+			{"getclientmatchdata", 306},
+			{"getclosestnodeinsight", 196},
+			{"getcostumefromtable", 718},
+			{"getcountertotal", 251},
+			{"getcsplinecount", 593},
+			{"getcsplinelength", 595},
+			{"getcsplinepointcorridordims", 600},
+			{"getcsplinepointcount", 594},
+			{"getcsplinepointdisttonextpoint", 602},
+			{"getcsplinepointid", 596},
+			{"getcsplinepointlabel", 597},
+			{"getcsplinepointposition", 599},
+			{"getcsplinepointtangent", 601},
+			{"getcsplinepointtension", 598},
+			{"getdvar", 56},
+			{"getdvarfloat", 58},
+			{"getdvarint", 57},
+			{"getdvarvector", 59},
+			{"getent", 406},
+			{"getentarray", 407},
+			{"getentbynum", 63},
+			{"getentchannelname", 471},
+			{"getentchannelscount", 470},
+			{"getentityweaponname", 666},
+			{"getfirstarraykey", 463},
+			{"getglass", 464},
+			{"getglassarray", 465},
+			{"getglassorigin", 466},
+			{"getgroundposition", 142},
+			{"getindexforluincstring", 204},
+			{"getlinkednodes", 527},
+			{"getlocaltime", 707},
+			{"getmapcustomfield", 248},
+			{"getmatchdata", 299},
+			{"getmatchrulesdata", 312},
+			{"getmaxagents", 506},
+			{"getmissileowner", 444},
+			{"getmovedelta", 143},
+			{"getnextarraykey", 436},
+			{"getnode", 191},
+			{"getnodearray", 192},
+			{"getnodesinradius", 194},
+			{"getnodesinradiussorted", 195},
+			{"getnodesintrigger", 509},
+			{"getnodesonpath", 511},
+			{"getnodezone", 517},
+			{"getnorthyaw", 145},
+			{"getnotetracktimes", 100},
+			{"getnumparam", 15},
+			{"getnumparts", 392},
+			{"getomnvar", 50},
+			{"getpartname", 426},
+			{"getpathdist", 526},
+			{"getplaylistid", 635},
+			{"getplaylistname", 706},
+			{"getplaylistversion", 634},
+			{"getpredictedentityposition", 608},
+			{"getradiometricunit", 62},
+			{"getscriptablearray", 560},
+			{"getspawnarray", 408},
+			{"getspawnerarray", 449},
+			{"getstanceandmotionstateforplayer", 701},
+			{"getstartangles", 109},
+			{"getstartorigin", 108},
+			{"getstarttime", 356},
+			{"getsubstr", 285},
+			{"getsystemtime", 311},
+			{"getteamplayersalive", 350},
+			{"getteamradar", 373},
+			{"getteamradarstrength", 375},
+			{"getteamscore", 346},
+			{"getthreatbias", 260},
+			{"gettime", 60},
+			{"getuavstrengthlevelneutral", 291},
+			{"getuavstrengthlevelshowenemydirectional", 293},
+			{"getuavstrengthlevelshowenemyfastsweep", 292},
+			{"getuavstrengthmax", 290},
+			{"getuavstrengthmin", 376},
+			{"getutc", 61},
+			{"getvehiclenode", 486},
+			{"getvehiclenodearray", 487},
+			{"getweaponarray", 1},
+			{"getweaponattachmentdisplaynames", 95},
+			{"getweaponattachments", 94},
+			{"getweaponbasename", 93},
+			{"getweaponcamoname", 96},
+			{"getweapondisplayname", 92},
+			{"getweaponexplosionradius", 520},
+			{"getweaponflashtagname", 446},
+			{"getweaponmodel", 64},
+			{"getweaponreticlename", 97},
+			{"getzonecount", 512},
+			{"getzonenearest", 513},
+			{"getzonenodeforindex", 519},
+			{"getzonenodes", 514},
+			{"getzonenodesbydist", 518},
+			{"getzoneorigin", 516},
+			{"getzonepath", 515},
+			{"glassradiusdamage", 390},
+			{"handlepickupdeployedriotshield", 716},
+			{"incrementcounter", 250},
+			{"invertangles", 587},
+			{"iprintln", 403},
+			{"iprintlnbold", 404},
+			{"isagent", 505},
+			{"isai", 203},
+			{"isalive", 412},
+			{"isalliedsentient", 644},
+			{"isarray", 202},
+			{"isbot", 504},
+			{"isdedicatedserver", 633},
+			{"isdefined", 46},
+			{"isendstr", 284},
+			{"isenemyteam", 264},
+			{"isexplosivedamagemod", 387},
+			{"isglassdestroyed", 467},
+			{"isonlinegame", 698},
+			{"isplayer", 424},
+			{"isplayernumber", 425},
+			{"ispointinvolume", 553},
+			{"isremovedentity", 659},
+			{"issentient", 205},
+			{"isspawner", 413},
+			{"issplitscreen", 315},
+			{"issquadsmode", 637},
+			{"isstring", 48},
+			{"issubstr", 283},
+			{"issystemlink", 699},
+			{"isteamradarblocked", 296},
+			{"istestclient", 645},
+			{"isusinghdr", 564},
+			{"isusingmatchrulesdata", 313},
+			{"isvalidgametype", 368},
+			{"isvalidmissile", 47},
+			{"isweaponcliponly", 482},
+			{"iszombie", 728},
+			{"kickplayer", 314},
+			{"killfxontag", 335},
+			{"length", 236},
+			{"length2d", 237},
+			{"length2dsquared", 239},
+			{"lengthsquared", 238},
+			{"loadfx", 331},
+			{"loadluifile", 632},
+			{"log", 225},
+			{"lootservicestarttrackingplaytime", 687},
+			{"lootservicevalidateplaytime", 689},
+			{"magicbullet", 445},
+			{"magicgrenademanual", 112},
+			{"mapexists", 367},
+			{"maprestart", 360},
+			{"max", 221},
+			{"min", 187},
+			{"missilecreateattractorent", 414},
+			{"missilecreateattractororigin", 415},
+			{"missilecreaterepulsorent", 416},
+			{"missilecreaterepulsororigin", 417},
+			{"missiledeleteattractor", 418},
+			{"newclienthudelem", 421},
+			{"newhudelem", 420},
+			{"newteamhudelem", 422},
+			{"nodeexposedtosky", 523},
+			{"nodegetremotemissilename", 711},
+			{"nodehasremotemissileset", 712},
+			{"nodesetremotemissilename", 725},
+			{"nodesvisible", 510},
+			{"obituary", 353},
+			{"objective_add", 472},
+			{"objective_current", 477},
+			{"objective_delete", 473},
+			{"objective_icon", 475},
+			{"objective_onentity", 393},
+			{"objective_onentitywithrotation", 394},
+			{"objective_player", 396},
+			{"objective_playerenemyteam", 398},
+			{"objective_playermask_hidefrom", 400},
+			{"objective_playermask_hidefromall", 399},
+			{"objective_playermask_showto", 402},
+			{"objective_playermask_showtoall", 401},
+			{"objective_playerteam", 397},
+			{"objective_position", 476},
+			{"objective_state", 474},
+			{"objective_team", 395},
+			{"physicsexplosioncylinder", 378},
+			{"physicsexplosionsphere", 377},
+			{"physicsradiusjitter", 380},
+			{"physicsradiusjolt", 379},
+			{"physicstrace", 140},
+			{"playcinematicforall", 679},
+			{"playerphysicstrace", 141},
+			{"playfx", 332},
+			{"playfxontag", 333},
+			{"playfxontagforclients", 339},
+			{"playloopedfx", 336},
+			{"playrumblelooponposition", 451},
+			{"playrumbleonposition", 450},
+			{"playsoundatpos", 419},
+			{"pointonsegmentnearesttopoint", 232},
+			{"positionwouldtelefrag", 354},
+			{"pow", 493},
+			{"precache", 490},
+			{"precacheheadicon", 357},
+			{"precacheitem", 324},
+			{"precachelaser", 592},
+			{"precacheleaderboards", 330},
+			{"precachelocationselector", 329},
+			{"precachematerial", 325},
+			{"precachemenu", 327},
+			{"precacheminimapicon", 358},
+			{"precachemodel", 322},
+			{"precachempanim", 359},
+			{"precacherumble", 328},
+			{"precacheshellshock", 323},
+			{"precachesound", 533},
+			{"precachestring", 326},
+			{"precacheturret", 0},
+			{"preloadcinematicforall", 680},
+			{"queuedialog", 615},
+			{"radiusdamage", 388},
+			{"randomcostume", 670},
+			{"randomfloat", 175},
+			{"randomfloatrange", 177},
+			{"randomint", 174},
+			{"randomintrange", 176},
+			{"recordbreadcrumbdataforplayer", 690},
+			{"remotemissileenttracetooriginpassed", 713},
+			{"resetentplayerxuidforemblems", 724},
+			{"resetsunlight", 69},
+			{"resettimeout", 423},
+			{"rotatepointaroundvector", 282},
+			{"rotatevector", 281},
+			{"rotatevectorinverted", 588},
+			{"sendclientmatchdata", 308},
+			{"sendmatchdata", 300},
+			{"setac130ambience", 247},
+			{"setatmosfog", 385},
+			{"setatmosfogdvarsonly", 386},
+			{"setclientmatchdata", 305},
+			{"setclientmatchdatadef", 307},
+			{"setclientnamemode", 348},
+			{"setdevdvar", 54},
+			{"setdevdvarifuninitialized", 55},
+			{"setdvar", 51},
+			{"setdvarifuninitialized", 53},
+			{"setdynamicdvar", 52},
+			{"setentplayerxuidforemblem", 723},
+			{"setexpfog", 381},
+			{"setexpfogdvarsonly", 383},
+			{"setexpfogext", 382},
+			{"setexpfogextdvarsonly", 384},
+			{"setgameendtime", 317},
+			{"setignoremegroup", 263},
+			{"setleveldopplerpreset", 562},
+			{"setmapcenter", 316},
+			{"setmatchclientip", 303},
+			{"setmatchdata", 298},
+			{"setmatchdatadef", 302},
+			{"setmatchdataid", 304},
+			{"setminimap", 460},
+			{"setnojipscore", 606},
+			{"setnojiptime", 607},
+			{"setnorthyaw", 172},
+			{"setomnvar", 49},
+			{"setplayerignoreradiusdamage", 389},
+			{"setplayerteamrank", 370},
+			{"setslowmotion", 173},
+			{"setsunlight", 68},
+			{"setteammode", 345},
+			{"setteamradar", 372},
+			{"setteamradarstrength", 374},
+			{"setteamscore", 347},
+			{"setthermalbodymaterial", 461},
+			{"setthreatbias", 261},
+			{"setthreatbiasagainstall", 262},
+			{"setwinningteam", 342},
+			{"shootblank", 671},
+			{"sighttracepassed", 139},
+			{"sin", 178},
+			{"sortbydistance", 437},
+			{"soundexists", 453},
+			{"spawn", 101},
+			{"spawnfx", 337},
+			{"spawnfxforclient", 625},
+			{"spawnhelicopter", 411},
+			{"spawnloopingsound", 103},
+			{"spawnplane", 409},
+			{"spawnsighttrace", 249},
+			{"spawnturret", 23},
+			{"spawnvehicle", 491},
+			{"sqrt", 226},
+			{"squared", 227},
+			{"startservermigration", 246},
+			{"stopallrumbles", 452},
+			{"stopcinematicforall", 681},
+			{"stopfxontag", 334},
+			{"stricmp", 288},
+			{"strtok", 287},
+			{"sub_1402d2850", 646},
+			{"sub_1402d3460", 720},
+			{"sub_1402d3540", 702},
+			{"sub_1402d35b0", 703},
+			{"sub_14030d340", 653},
+			{"sub_14030da60", 654},
+			{"sub_14030dfc0", 483},
+			{"sub_14030e400", 484},
+			{"sub_14030e5c0", 655},
+			{"sub_14030e700", 664},
+			{"sub_14030ec50", 568},
+			{"sub_14030f050", 569},
+			{"sub_14030f340", 570},
+			{"sub_14030f550", 571},
+			{"sub_14030f710", 572},
+			{"sub_140310ec0", 641},
+			{"sub_140311100", 651},
+			{"sub_140311a40", 567},
+			{"sub_140311ad0", 117},
+			{"sub_140311d80", 118},
+			{"sub_140311d90", 119},
+			{"sub_140311df0", 120},
+			{"sub_140311ef0", 121},
+			{"sub_140311f50", 122},
+			{"sub_140311ff0", 648},
+			{"sub_140312040", 649},
+			{"sub_140314c70", 652},
+			{"sub_1403163c0", 581},
+			{"sub_140317140", 658},
+			{"sub_140317df0", 691},
+			{"sub_140319200", 733},
+			{"sub_140319680", 675},
+			{"sub_14031a690", 580},
+			{"sub_14031aa80", 726},
+			{"sub_14031b670", 729},
+			{"sub_14031bae0", 642},
+			{"sub_14031be80", 341},
+			{"sub_14031c2b0", 643},
+			{"sub_14031ca40", 683},
+			{"sub_14031d3f0", 730},
+			{"sub_14031e1f0", 684},
+			{"sub_14031e670", 731},
+			{"sub_14031ead0", 727},
+			{"sub_14031fb60", 127},
+			{"sub_14031fc20", 667},
+			{"sub_14031fda0", 657},
+			{"sub_140321880", 685},
+			{"sub_140321ae0", 697},
+			{"sub_140321c40", 565},
+			{"sub_140322690", 574},
+			{"sub_140328710", 297},
+			{"sub_1403295e0", 573},
+			{"sub_140329600", 575},
+			{"sub_1403297b0", 688},
+			{"sub_14032c6b0", 717},
+			{"sub_14032c820", 708},
+			{"sub_140331e00", 734},
+			{"sub_1403326a0", 340},
+			{"sub_140332a70", 704},
+			{"sub_140332ae0", 705},
+			{"sub_140337920", 694},
+			{"sysprint", 693},
+			{"tableexists", 443},
+			{"tablegetcolumncount", 661},
+			{"tablegetrowcount", 660},
+			{"tablelookup", 438},
+			{"tablelookupbyrow", 439},
+			{"tablelookupistring", 440},
+			{"tablelookupistringbyrow", 441},
+			{"tablelookuprownum", 442},
+			{"tan", 180},
+			{"threatbiasgroupexists", 259},
+			{"tolower", 286},
+			{"trajectorycalculateexitangle", 548},
+			{"trajectorycalculateinitialvelocity", 546},
+			{"trajectorycalculateminimumvelocity", 547},
+			{"trajectorycanattemptaccuratejump", 551},
+			{"trajectorycomputedeltaheightattime", 550},
+			{"trajectoryestimatedesiredinairtime", 549},
+			{"transformmove", 280},
+			{"triggerfx", 338},
+			{"triggerportableradarping", 622},
+			{"unblockteamradar", 295},
+			{"updateclientnames", 349},
+			{"validatecostume", 669},
+			{"vectorcross", 242},
+			{"vectordot", 241},
+			{"vectorfromlinetopoint", 231},
+			{"vectorlerp", 274},
+			{"vectornormalize", 271},
+			{"vectortoangles", 272},
+			{"vectortoyaw", 273},
+			{"visionsetmissilecam", 320},
+			{"visionsetnaked", 318},
+			{"visionsetnight", 319},
+			{"visionsetpain", 245},
+			{"visionsetpostapply", 639},
+			{"visionsetthermal", 244},
+			{"weaponaltweaponname", 481},
+			{"weaponburstcount", 433},
+			{"weaponclass", 435},
+			{"weaponclipsize", 428},
+			{"weaponfiretime", 427},
+			{"weaponhasthermalscope", 485},
+			{"weaponinheritsperks", 432},
+			{"weaponinventorytype", 478},
+			{"weaponisauto", 429},
+			{"weaponisboltaction", 431},
+			{"weaponissemiauto", 430},
+			{"weaponmaxammo", 480},
+			{"weaponstartammo", 479},
+			{"weapontype", 434},
+			{"worldentnumber", 352}
+		};
 
-	std::unordered_map<std::string, unsigned> method_map =
-	{
-		{"thermaldrawdisable", 32768},
-		{"heli_setdamagestage", 32770},
-		{"playsoundtoteam", 32771},
-		{"playsoundtoplayer", 32772},
-		{"playerhide", 32773},
-		{"playershow", 32774},
-		{"showtoplayer", 32775},
-		{"threatdetectedtoplayer", 32776},
-		{"clearthreatdetected", 32777},
-		{"enableplayeruse", 32778},
-		{"disableplayeruse", 32779},
-		{"enableammogeneration", 32780},
-		{"disableammogeneration", 32781},
-		{"makescrambler", 32782},
-		{"makeportableradar", 32783},
-		{"clearscrambler", 32784},
-		{"clearportableradar", 32785},
-		{"placespawnpoint", 32786},
-		{"setteamfortrigger", 32787},
-		{"clientclaimtrigger", 32788},
-		{"clientreleasetrigger", 32789},
-		{"releaseclaimedtrigger", 32790},
-		{"isusingonlinedataoffline", 32791},
-		{"getrestedtime", 32792},
-		{"sendleaderboards", 32793},
-		{"isonladder", 32794},
-		{"getcorpseanim", 32795},
-		{"playerforcedeathanim", 32796},
-		{"attach", 32797},
-		{"startragdoll", 32803},
-		{"thermaldrawenable", 32809},
-		{"detach", 32810},
-		{"detachall", 32811},
-		{"getattachsize", 32812},
-		{"getattachmodelname", 32813},
-		{"getattachtagname", 32814},
-		{"gethighestnodestance", 32820},
-		{"doesnodeallowstance", 32821},
-		{"getlightcolor", 32835},
-		{"setlightcolor", 32836},
-		{"getattachignorecollision", 32839},
-		{"hidepart", 32840},
-		{"hidepartallinstances", 32841},
-		{"hideallparts", 32842},
-		{"showpart", 32843},
-		{"showallparts", 32844},
-		{"linkto", 32845},
-		{"linktoblendtotag", 32846},
-		{"unlink", 32847},
-		{"setnormalhealth", 32848},
-		{"dodamage", 32849},
-		{"show", 32851},
-		{"hide", 32852},
-		{"disconnectpaths", 32855},
-		{"connectpaths", 32856},
-		{"disconnectnode", 32857},
-		{"connectnode", 32858},
-		{"digitaldistortsetparams", 32868},
-		{"setmode", 32869},
-		{"getmode", 32870},
-		{"islinked", 32872},
-		{"enablelinkto", 32873},
-		{"setpitch", 32876},
-		{"scalepitch", 32877},
-		{"setvolume", 32878},
-		{"scalevolume", 32879},
-		{"playsound", 32884},
-		{"playloopsound", 32885},
-		{"getnormalhealth", 32891},
-		{"playerlinkto", 32892},
-		{"playerlinktodelta", 32893},
-		{"playerlinkweaponviewtodelta", 32894},
-		{"playerlinktoabsolute", 32895},
-		{"playerlinktoblend", 32896},
-		{"playerlinkedoffsetenable", 32897},
-		{"setwaypointedgestyle_secondaryarrow", 32898},
-		{"setwaypointiconoffscreenonly", 32899},
-		{"fadeovertime", 32900},
-		{"scaleovertime", 32901},
-		{"moveovertime", 32902},
-		{"reset", 32903},
-		{"destroy", 32904},
-		{"setpulsefx", 32905},
-		{"setplayernamestring", 32906},
-		{"changefontscaleovertime", 32907},
-		{"playersetgroundreferenceent", 32913},
-		{"dontinterpolate", 32914},
-		{"getorigin", 32917},
-		{"useby", 32921},
-		{"playsoundasmaster", 32922},
-		{"playerlinkedoffsetdisable", 32927},
-		{"playerlinkedsetviewznear", 32928},
-		{"playerlinkedsetusebaseangleforviewclamp", 32929},
-		{"lerpviewangleclamp", 32930},
-		{"geteye", 32936},
-		{"istouching", 32937},
-		{"getistouchingentities", 32938},
-		{"stoploopsound", 32939},
-		{"stopsounds", 32940},
-		{"playrumbleonentity", 32941},
-		{"playrumblelooponentity", 32942},
-		{"stoprumble", 32943},
-		{"delete", 32944},
-		{"setmodel", 32945},
-		{"laseron", 32946},
-		{"laseroff", 32947},
-		{"thermalvisionon", 32950},
-		{"thermalvisionoff", 32951},
-		{"thermalvisionfofoverlayon", 32952},
-		{"thermalvisionfofoverlayoff", 32953},
-		{"autospotoverlayon", 32954},
-		{"autospotoverlayoff", 32955},
-		{"seteyesonuplinkenabled", 32956},
-		{"setcontents", 32958},
-		{"makeusable", 32959},
-		{"makeunusable", 32960},
-		{"makeglobalusable", 32961},
-		{"makeglobalunusable", 32962},
-		{"settext", 32970},
-		{"setmaterial", 32972},
-		{"settargetent", 32973},
-		{"cleartargetent", 32974},
-		{"settimer", 32975},
-		{"settimerup", 32976},
-		{"settimerstatic", 32977},
-		{"settenthstimer", 32978},
-		{"settenthstimerup", 32979},
-		{"settenthstimerstatic", 32980},
-		{"setclock", 32981},
-		{"setclockup", 32982},
-		{"setvalue", 32983},
-		{"setwaypoint", 32984},
-		{"setwaypointedgestyle_rotatingicon", 32985},
-		{"setcursorhint", 32986},
-		{"sethintstring", 32987},
-		{"setsecondaryhintstring", 32988},
-		{"forceusehinton", 32989},
-		{"forceusehintoff", 32990},
-		{"makesoft", 32991},
-		{"makehard", 32992},
-		{"entitywillneverchange", 32993},
-		{"startfiring", 32994},
-		{"stopfiring", 32995},
-		{"isfiringturret", 32996},
-		{"startbarrelspin", 32997},
-		{"stopbarrelspin", 32998},
-		{"getbarrelspinrate", 32999},
-		{"remotecontrolturret", 33000},
-		{"remotecontrolturretoff", 33001},
-		{"shootturret", 33002},
-		{"getturretowner", 33003},
-		{"giveachievement", 33017},
-		{"sub_1402ddb00", 33022},
-		{"sub_1402ddcc0", 33023},
-		{"setsentryowner", 33027},
-		{"setsentrycarrier", 33028},
-		{"setturretminimapvisible", 33029},
-		{"settargetentity", 33030},
-		{"snaptotargetentity", 33031},
-		{"cleartargetentity", 33032},
-		{"getturrettarget", 33033},
-		{"setplayerspread", 33034},
-		{"setaispread", 33035},
-		{"setsuppressiontime", 33036},
-		{"allowstand", 33048},
-		{"allowcrouch", 33049},
-		{"allowprone", 33050},
-		{"sub_1402dd9e0", 33051},
-		{"isthrowinggrenade", 33068},
-		{"isfiring", 33069},
-		{"ismeleeing", 33070},
-		{"allowmelee", 33072},
-		{"allowfire", 33073},
-		{"setconvergencetime", 33075},
-		{"setconvergenceheightpercent", 33076},
-		{"setturretteam", 33077},
-		{"maketurretsolid", 33078},
-		{"maketurretoperable", 33079},
-		{"maketurretinoperable", 33080},
-		{"makeentitysentient", 33081},
-		{"freeentitysentient", 33082},
-		{"setrightarc", 33109},
-		{"setleftarc", 33110},
-		{"settoparc", 33111},
-		{"setbottomarc", 33112},
-		{"setautorotationdelay", 33113},
-		{"setdefaultdroppitch", 33114},
-		{"restoredefaultdroppitch", 33115},
-		{"turretfiredisable", 33116},
-		{"getenemyinfo", 33125},
-		{"getenemysqdist", 33141},
-		{"getclosestenemysqdist", 33142},
-		{"setthreatbiasgroup", 33143},
-		{"getthreatbiasgroup", 33144},
-		{"turretfireenable", 33145},
-		{"setturretmodechangewait", 33146},
-		{"usetriggerrequirelookat", 33147},
-		{"getstance", 33148},
-		{"setstance", 33149},
-		{"itemweaponsetammo", 33150},
-		{"getammocount", 33151},
-		{"gettagorigin", 33152},
-		{"gettagangles", 33153},
-		{"shellshock", 33154},
-		{"stunplayer", 33155},
-		{"stopshellshock", 33156},
-		{"fadeoutshellshock", 33157},
-		{"setdepthoffield", 33158},
-		{"setviewmodeldepthoffield", 33159},
-		{"setmotionblurmovescale", 33160},
-		{"getnegotiationstartnode", 33181},
-		{"getnegotiationendnode", 33182},
-		{"getnegotiationnextnode", 33183},
-		{"setmotionblurturnscale", 33197},
-		{"setmotionblurzoomscale", 33198},
-		{"viewkick", 33199},
-		{"localtoworldcoords", 33200},
-		{"getentitynumber", 33201},
-		{"getentityvelocity", 33202},
-		{"enablegrenadetouchdamage", 33203},
-		{"disablegrenadetouchdamage", 33204},
-		{"enableaimassist", 33205},
-		{"lastknowntime", 33216},
-		{"lastknownpos", 33217},
-		{"disableaimassist", 33236},
-		{"entityradiusdamage", 33237},
-		{"detonate", 33238},
-		{"damageconetrace", 33239},
-		{"sightconetrace", 33240},
-		{"missilesettargetent", 33241},
-		{"missilesettargetpos", 33242},
-		{"missilecleartarget", 33243},
-		{"missilesetflightmodedirect", 33244},
-		{"missilesetflightmodetop", 33245},
-		{"getlightintensity", 33246},
-		{"setlightintensity", 33247},
-		{"isragdoll", 33248},
-		{"setmovespeedscale", 33249},
-		{"cameralinkto", 33250},
-		{"cameraunlink", 33251},
-		{"controlslinkto", 33280},
-		{"controlsunlink", 33281},
-		{"makevehiclesolidcapsule", 33282},
-		{"makevehiclesolidsphere", 33284},
-		{"remotecontrolvehicle", 33286},
-		{"remotecontrolvehicleoff", 33287},
-		{"isfiringvehicleturret", 33288},
-		{"remotecontrolvehicletarget", 33289},
-		{"remotecontrolvehicletargetoff", 33290},
-		{"drivevehicleandcontrolturret", 33291},
-		{"drivevehicleandcontrolturretoff", 33292},
-		{"getplayersetting", 33293},
-		{"getlocalplayerprofiledata", 33294},
-		{"setlocalplayerprofiledata", 33295},
-		{"remotecamerasoundscapeon", 33296},
-		{"remotecamerasoundscapeoff", 33297},
-		{"setmotiontrackervisible", 33298},
-		{"getmotiontrackervisible", 33299},
-		{"worldpointinreticle_circle", 33300},
-		{"worldpointinreticle_rect", 33301},
-		{"getpointinbounds", 33302},
-		{"transfermarkstonewscriptmodel", 33303},
-		{"setwatersheeting", 33304},
-		{"setweaponhudiconoverride", 33307},
-		{"getweaponhudiconoverride", 33308},
-		{"setempjammed", 33309},
-		{"playersetexpfogext", 33310},
-		{"playersetexpfog", 33311},
-		{"playersetatmosfog", 33312},
-		{"isitemunlocked", 33313},
-		{"getplayerdata", 33314},
-		{"getrankedplayerdata", 33315},
-		{"getprivateplayerdata", 33316},
-		{"getcoopplayerdata", 33317},
-		{"getcommonplayerdata", 33318},
-		{"vehicleturretcontroloff", 33319},
-		{"isturretready", 33320},
-		{"vehicledriveto", 33321},
-		{"dospawn", 33322},
-		{"isphysveh", 33323},
-		{"crash", 33324},
-		{"launch", 33325},
-		{"disablecrashing", 33326},
-		{"enablecrashing", 33327},
-		{"setphysvehspeed", 33328},
-		{"setconveyorbelt", 33329},
-		{"freevehicle", 33330},
-		{"setplayerdata", 33347},
-		{"setrankedplayerdata", 33348},
-		{"setprivateplayerdata", 33349},
-		{"setcoopplayerdata", 33350},
-		{"setcommonplayerdata", 33351},
-		{"getcacplayerdata", 33352},
-		{"setcacplayerdata", 33353},
-		{"trackerupdate", 33354},
-		{"pingplayer", 33355},
-		{"buttonpressed", 33356},
-		{"sayall", 33357},
-		{"sayteam", 33358},
-		{"setspawnweapon", 33359},
-		{"dropitem", 33360},
-		{"dropscavengerbag", 33361},
-		{"setjitterparams", 33362},
-		{"sethoverparams", 33363},
-		{"joltbody", 33364},
-		{"getwheelsurface", 33366},
-		{"getvehicleowner", 33367},
-		{"setvehiclelookattext", 33368},
-		{"setvehicleteam", 33369},
-		{"neargoalnotifydist", 33370},
-		{"setvehgoalpos", 33371},
-		{"setgoalyaw", 33372},
-		{"cleargoalyaw", 33373},
-		{"settargetyaw", 33374},
-		{"cleartargetyaw", 33375},
-		{"helisetgoal", 33376},
-		{"setturrettargetvec", 33377},
-		{"setturrettargetent", 33378},
-		{"clearturrettargetent", 33379},
-		{"canturrettargetpoint", 33380},
-		{"setlookatent", 33381},
-		{"clearlookatent", 33382},
-		{"setweapon", 33383},
-		{"fireweapon", 33384},
-		{"vehicleturretcontrolon", 33385},
-		{"finishplayerdamage", 33386},
-		{"suicide", 33387},
-		{"closeingamemenu", 33388},
-		{"iclientprintln", 33389},
-		{"iclientprintlnbold", 33390},
-		{"spawn", 33391},
-		{"setentertime", 33392},
-		{"cloneplayer", 33393},
-		{"istalking", 33394},
-		{"allowspectateteam", 33395},
-		{"forcespectatepov", 33396},
-		{"getguid", 33397},
-		{"physicslaunchserver", 33398},
-		{"physicslaunchserveritem", 33399},
-		{"clonebrushmodeltoscriptmodel", 33400},
-		{"scriptmodelplayanim", 33401},
-		{"scriptmodelclearanim", 33402},
-		{"scriptmodelplayanimdeltamotion", 33403},
-		{"teleport", 33404},
-		{"attachpath", 33405},
-		{"getattachpos", 33406},
-		{"startpath", 33407},
-		{"setswitchnode", 33408},
-		{"setwaitspeed", 33409},
-		{"finishdamage", 33410},
-		{"setspeed", 33411},
-		{"setspeedimmediate", 33412},
-		{"rotatevehyaw", 33413},
-		{"getspeed", 33414},
-		{"getvehvelocity", 33415},
-		{"getbodyvelocity", 33416},
-		{"getsteering", 33417},
-		{"getthrottle", 33418},
-		{"turnengineoff", 33419},
-		{"turnengineon", 33420},
-		{"getgoalspeedmph", 33422},
-		{"setacceleration", 33423},
-		{"setdeceleration", 33424},
-		{"resumespeed", 33425},
-		{"setyawspeed", 33426},
-		{"setyawspeedbyname", 33427},
-		{"setmaxpitchroll", 33428},
-		{"setairresitance", 33429},
-		{"setturningability", 33430},
-		{"getxuid", 33431},
-		{"getucdidhigh", 33432},
-		{"getucdidlow", 33433},
-		{"getclanidhigh", 33434},
-		{"getclanidlow", 33435},
-		{"ishost", 33436},
-		{"getspectatingplayer", 33437},
-		{"predictstreampos", 33438},
-		{"setrank", 33441},
-		{"weaponlocknoclearance", 33443},
-		{"visionsyncwithplayer", 33444},
-		{"showhudsplash", 33445},
-		{"setperk", 33446},
-		{"hasperk", 33447},
-		{"clearperks", 33448},
-		{"unsetperk", 33449},
-		{"registerparty", 33450},
-		{"getfireteammembers", 33451},
-		{"moveto", 33454},
-		{"movex", 33455},
-		{"movey", 33456},
-		{"movez", 33457},
-		{"gravitymove", 33458},
-		{"moveslide", 33459},
-		{"stopmoveslide", 33460},
-		{"rotateto", 33461},
-		{"rotatepitch", 33462},
-		{"rotateyaw", 33463},
-		{"rotateroll", 33464},
-		{"addpitch", 33465},
-		{"addyaw", 33466},
-		{"addroll", 33467},
-		{"vibrate", 33468},
-		{"rotatevelocity", 33469},
-		{"solid", 33470},
-		{"notsolid", 33471},
-		{"setcandamage", 33472},
-		{"setcanradiusdamage", 33473},
-		{"physicslaunchclient", 33474},
-		{"setcarddisplayslot", 33477},
-		{"kc_regweaponforfxremoval", 33478},
-		{"laststandrevive", 33479},
-		{"laststand", 33480},
-		{"setspectatedefaults", 33481},
-		{"getthirdpersoncrosshairoffset", 33482},
-		{"disableweaponpickup", 33483},
-		{"enableweaponpickup", 33484},
-		{"issplitscreenplayer", 33485},
-		{"getweaponslistoffhands", 33486},
-		{"getweaponslistitems", 33487},
-		{"getweaponslistexclusives", 33488},
-		{"getweaponslist", 33489},
-		{"canplayerplacesentry", 33490},
-		{"canplayerplacetank", 33491},
-		{"visionsetnakedforplayer", 33492},
-		{"visionsetnightforplayer", 33493},
-		{"visionsetmissilecamforplayer", 33494},
-		{"visionsetthermalforplayer", 33495},
-		{"visionsetpainforplayer", 33496},
-		{"setblurforplayer", 33497},
-		{"getplayerweaponmodel", 33498},
-		{"getplayerknifemodel", 33499},
-		{"notifyonplayercommand", 33501},
-		{"canmantle", 33502},
-		{"forcemantle", 33503},
-		{"ismantling", 33504},
-		{"playfx", 33505},
-		{"playerrecoilscaleon", 33506},
-		{"playerrecoilscaleoff", 33507},
-		{"weaponlockstart", 33508},
-		{"weaponlockfinalize", 33509},
-		{"weaponlockfree", 33510},
-		{"weaponlocktargettooclose", 33511},
-		{"issplitscreenplayerprimary", 33512},
-		{"markforeyeson", 33513},
-		{"issighted", 33514},
-		{"getsightedplayers", 33515},
-		{"getplayerssightingme", 33516},
-		{"getviewmodel", 33517},
-		{"fragbuttonpressed", 33518},
-		{"secondaryoffhandbuttonpressed", 33519},
-		{"getcurrentweaponclipammo", 33520},
-		{"setvelocity", 33521},
-		{"getviewheight", 33522},
-		{"getnormalizedmovement", 33523},
-		{"playlocalsound", 33524},
-		{"stoplocalsound", 33525},
-		{"setweaponammoclip", 33526},
-		{"setweaponammostock", 33527},
-		{"getweaponammoclip", 33528},
-		{"getweaponammostock", 33529},
-		{"anyammoforweaponmodes", 33530},
-		{"setclientomnvar", 33531},
-		{"setclientdvar", 33532},
-		{"setclientdvars", 33533},
-		{"setclientspawnsighttraces", 33534},
-		{"clientspawnsighttracepassed", 33535},
-		{"allowads", 33536},
-		{"allowjump", 33537},
-		{"allowladder", 33538},
-		{"allowmantle", 33539},
-		{"allowsprint", 33540},
-		{"setspreadoverride", 33541},
-		{"resetspreadoverride", 33542},
-		{"setaimspreadmovementscale", 33543},
-		{"setactionslot", 33544},
-		{"setviewkickscale", 33545},
-		{"getviewkickscale", 33546},
-		{"getweaponslistall", 33547},
-		{"getweaponslistprimaries", 33548},
-		{"getnormalizedcameramovement", 33549},
-		{"giveweapon", 33550},
-		{"takeweapon", 33551},
-		{"takeallweapons", 33552},
-		{"getcurrentweapon", 33553},
-		{"getcurrentprimaryweapon", 33554},
-		{"getcurrentoffhand", 33555},
-		{"hasweapon", 33556},
-		{"switchtoweapon", 33557},
-		{"switchtoweaponimmediate", 33558},
-		{"sub_1402e1d60", 33559},
-		{"switchtooffhand", 33560},
-		{"setoffhandsecondaryclass", 33561},
-		{"getoffhandsecondaryclass", 33562},
-		{"beginlocationselection", 33563},
-		{"endlocationselection", 33564},
-		{"disableweapons", 33565},
-		{"enableweapons", 33566},
-		{"disableoffhandweapons", 33567},
-		{"enableoffhandweapons", 33568},
-		{"disableweaponswitch", 33569},
-		{"enableweaponswitch", 33570},
-		{"openpopupmenu", 33571},
-		{"openpopupmenunomouse", 33572},
-		{"closepopupmenu", 33573},
-		{"openmenu", 33574},
-		{"closemenu", 33575},
-		{"freezecontrols", 33577},
-		{"disableusability", 33578},
-		{"enableusability", 33579},
-		{"setwhizbyspreads", 33580},
-		{"setwhizbyradii", 33581},
-		{"setchannelvolume", 33584},
-		{"givestartammo", 33585},
-		{"givemaxammo", 33586},
-		{"getfractionstartammo", 33587},
-		{"getfractionmaxammo", 33588},
-		{"isdualwielding", 33589},
-		{"isreloading", 33590},
-		{"isswitchingweapon", 33591},
-		{"setorigin", 33592},
-		{"getvelocity", 33593},
-		{"setangles", 33594},
-		{"getangles", 33595},
-		{"usebuttonpressed", 33596},
-		{"attackbuttonpressed", 33597},
-		{"adsbuttonpressed", 33598},
-		{"meleebuttonpressed", 33599},
-		{"playerads", 33600},
-		{"isonground", 33601},
-		{"isusingturret", 33602},
-		{"setviewmodel", 33603},
-		{"setoffhandprimaryclass", 33604},
-		{"getoffhandprimaryclass", 33605},
-		{"sub_14032dff0", 33610},
-		{"sub_14032e040", 33611},
-		{"enablemousesteer", 33612},
-		{"setscriptmoverkillcam", 33613},
-		{"usinggamepad", 33614},
-		{"forcethirdpersonwhenfollowing", 33615},
-		{"disableforcethirdpersonwhenfollowing", 33616},
-		{"botsetflag", 33617},
-		{"botsetstance", 33618},
-		{"botsetscriptmove", 33619},
-		{"botsetscriptgoal", 33620},
-		{"botsetscriptgoalnode", 33621},
-		{"botclearscriptgoal", 33622},
-		{"botsetscriptenemy", 33623},
-		{"botclearscriptenemy", 33624},
-		{"botsetattacker", 33625},
-		{"botgetscriptgoal", 33626},
-		{"botgetscriptgoalradius", 33627},
-		{"botgetscriptgoalyaw", 33628},
-		{"botgetscriptgoaltype", 33629},
-		{"botgetworldsize", 33631},
-		{"botnodeavailable", 33632},
-		{"botfindnoderandom", 33633},
-		{"botmemoryevent", 33634},
-		{"botnodepick", 33636},
-		{"bothasscriptgoal", 33637},
-		{"botgetpersonality", 33638},
-		{"botthrowgrenade", 33639},
-		{"botsetpersonality", 33641},
-		{"botsetdifficulty", 33642},
-		{"botgetdifficulty", 33643},
-		{"botgetworldclosestedge", 33644},
-		{"botlookatpoint", 33645},
-		{"botpredictseepoint", 33646},
-		{"botcanseeentity", 33647},
-		{"botgetnodesonpath", 33648},
-		{"botnodepickmultiple", 33649},
-		{"botgetfovdot", 33651},
-		{"botsetawareness", 33652},
-		{"botpursuingscriptgoal", 33653},
-		{"botgetscriptgoalnode", 33654},
-		{"botgetimperfectenemyinfo", 33655},
-		{"botsetpathingstyle", 33657},
-		{"botsetdifficultysetting", 33658},
-		{"botgetdifficultysetting", 33659},
-		{"botgetpathdist", 33660},
-		{"botisrandomized", 33661},
-		{"botpressbutton", 33662},
-		{"botclearbutton", 33663},
-		{"botnodescoremultiple", 33664},
-		{"getnodenumber", 33665},
-		{"setclientowner", 33666},
-		{"setotherent", 33667},
-		{"setaisightlinevisible", 33668},
-		{"setentityowner", 33669},
-		{"nodeisdisconnected", 33670},
-		{"getnearestnode", 33671},
-		{"makeentitynomeleetarget", 33672},
-		{"spawnagent", 33674},
-		{"finishagentdamage", 33675},
-		{"setagentattacker", 33676},
-		{"cloneagent", 33677},
-		{"agentcanseesentient", 33678},
-		{"setagentwaypoint", 33679},
-		{"setgoalpos", 33680},
-		{"getgoalpos", 33681},
-		{"setgoalnode", 33682},
-		{"setgoalentity", 33683},
-		{"setgoalradius", 33684},
-		{"setanimscale", 33685},
-		{"setorientmode", 33686},
-		{"setanimmode", 33687},
-		{"setphysicsmode", 33688},
-		{"setclipmode", 33689},
-		{"setmaxturnspeed", 33690},
-		{"getmaxturnspeed", 33691},
-		{"beginmelee", 33692},
-		{"setscripted", 33693},
-		{"dotrajectory", 33694},
-		{"doanimlerp", 33695},
-		{"setviewheight", 33696},
-		{"claimnode", 33697},
-		{"relinquishclaimednode", 33698},
-		{"setradarping", 33699},
-		{"visitfxent", 33700},
-		{"sub_1402ef480", 33701},
-		{"sub_1402ef4e0", 33702},
-		{"sub_1402dd560", 33704},
-		{"sub_1402dd590", 33705},
-		{"allowhighjump", 33714},
-		{"isjumping", 33715},
-		{"ishighjumping", 33716},
-		{"sub_140529a10", 33717},
-		{"sub_140529a20", 33718},
-		{"getbraggingright", 33719},
-		{"getmodelfromentity", 33720},
-		{"getweaponheatlevel", 33721},
-		{"isweaponoverheated", 33722},
-		{"isshiftbuttonpresseddown", 33723},
-		{"sub_14052be00", 33724},
-		{"sub_14052beb0", 33725},
-		{"sub_14052bf30", 33726},
-		{"lightsetforplayer", 33728},
-		{"lightsetoverrideenableforplayer", 33729},
-		{"lightsetoverridedisableforplayer", 33730},
-		{"sub_140333c10", 33731},
-		{"sub_140043710", 33732},
-		{"sub_14052b420", 33733},
-		{"sub_1402ddd70", 33734},
-		{"setanimclass", 33744},
-		{"enableanimstate", 33745},
-		{"setanimstate", 33746},
-		{"getanimentry", 33747},
-		{"getanimentryname", 33748},
-		{"getanimentryalias", 33749},
-		{"getanimentrycount", 33750},
-		{"issprinting", 33752},
-		{"jumpbuttonpressed", 33758},
-		{"rotateby", 33759},
-		{"getlookaheaddir", 33760},
-		{"getpathgoalpos", 33761},
-		{"sub_140316940", 33762},
-		{"setcorpsefalling", 33763},
-		{"setsurfacetype", 33764},
-		{"aiphysicstrace", 33765},
-		{"aiphysicstracepassed", 33766},
-		{"visionsetstage", 33770},
-		{"linkwaypointtotargetwithoffset", 33771},
-		{"getlinkedparent", 33772},
-		{"getmovingplatformparent", 33773},
-		{"setnameplatematerial", 33774},
-		{"sub_140313d20", 33777},
-		{"sub_1403131d0", 33778},
-		{"makevehiclenotcollidewithplayers", 33779},
-		{"setscriptablepartstate", 33782},
-		{"stopsliding", 33783},
-		{"sub_140316a60", 33784},
-		{"setdronegoalpos", 33785},
-		{"hudoutlineenable", 33786},
-		{"hudoutlinedisable", 33787},
-		{"worldpointtoscreenpos", 33792},
-		{"botfirstavailablegrenade", 33795},
-		{"emissiveblend", 33801},
-		{"sub_1402e66d0", 33804},
-		{"sub_1402e66e0", 33805},
-		{"sub_1402e66f0", 33806},
-		{"physicssetmaxlinvel", 33810},
-		{"physicssetmaxangvel", 33811},
-		{"physicsgetlinvel", 33812},
-		{"physicsgetlinspeed", 33813},
-		{"physicsgetangvel", 33814},
-		{"physicsgetangspeed", 33815},
-		{"disablemissileboosting", 33816},
-		{"enablemissileboosting", 33817},
-		{"canspawntestclient", 33818},
-		{"spawntestclient", 33819},
-		{"loadcustomizationplayerview", 33820},
-		{"setgrenadethrowscale", 33821},
-		{"setgrenadecookscale", 33822},
-		{"setplanesplineid", 33823},
-		{"hudoutlineenableforclient", 33824},
-		{"hudoutlinedisableforclient", 33825},
-		{"hudoutlineenableforclients", 33826},
-		{"hudoutlinedisableforclients", 33827},
-		{"turretsetbarrelspinenabled", 33828},
-		{"hasloadedcustomizationplayerview", 33829},
-		{"sub_140313420", 33830},
-		{"sub_1403136f0", 33831},
-		{"doanimrelative", 33832},
-		{"getcorpseentity", 33836},
-		{"logmatchdatalife", 33838},
-		{"logmatchdatadeath", 33839},
-		{"queuedialogforplayer", 33840},
-		{"setmlgcameradefaults", 33841},
-		{"ismlgspectator", 33842},
-		{"disableautoreload", 33843},
-		{"enableautoreload", 33844},
-		{"getlinkedchildren", 33846},
-		{"botpredictenemycampspots", 33847},
-		{"playsoundonmovingent", 33848},
-		{"cancelmantle", 33849},
-		{"hasfemalecustomizationmodel", 33850},
-		{"sub_1402e6bb0", 33851},
-		{"setscriptabledamageowner", 33852},
-		{"setfxkilldefondelete", 33853},
-		{"sub_1402e1b80", 33856},
-		{"sub_140310fb0", 33858},
-		{"challengenotification", 33859},
-		{"sub_140528300", 33860},
-		{"sub_14052bff0", 33861},
-		{"linktosynchronizedparent", 33862},
-		{"getclientomnvar", 33863},
-		{"getcacplayerdataforgroup", 33866},
-		{"cloakingenable", 33867},
-		{"cloakingdisable", 33868},
-		{"getunnormalizedcameramovement", 33869},
-		{"sub_14031edf0", 33870},
-		{"isturretoverheated", 33871},
-		{"sub_14052c170", 33872},
-		{"sub_14052c190", 33873},
-		{"sub_14052c1b0", 33874},
-		{"sub_14052c1d0", 33875},
-		{"sub_14052c0b0", 33878},
-		{"sub_1402de140", 33879},
-		{"getvieworigin", 33884},
-		{"setweaponmodelvariant", 33885},
-		{"ridevehicle", 33886},
-		{"stopridingvehicle", 33887},
-		{"autoboltmissileeffects", 33889},
-		{"disablemissilestick", 33890},
-		{"enablemissilestick", 33891},
-		{"setmissileminimapvisible", 33892},
-		{"isoffhandweaponreadytothrow", 33893},
-		{"makecollidewithitemclip", 33895},
-		{"visionsetpostapplyforplayer", 33897},
-		{"setlookattarget", 33898},
-		{"clearlookattarget", 33899},
-		{"sub_14052c250", 33907},
-		{"sub_14052c290", 33908},
-		{"sub_14052c2f0", 33909},
-		{"sub_14052c340", 33910},
-		{"sub_14052c360", 33911},
-		{"sub_14031c170", 33912},
-		{"sub_14031c590", 33913},
-		{"setclienttriggervisionset", 33914},
-		{"sub_1402e41c0", 33917},
-		{"sub_1402e43b0", 33918},
-		{"sub_14052b4d0", 33919},
-		{"sub_14052b550", 33920},
-		{"showviewmodel", 33921},
-		{"hideviewmodel", 33922},
-		{"setpickupweapon", 33923},
-		{"allowpowerslide", 33925},
-		{"allowhighjumpdrop", 33926},
-		{"sub_1404045e0", 33927},
-		{"sub_1405297e0", 33928},
-		{"sub_14052c200", 33929},
-		{"clearentity", 33930},
-		{"sub_140334a40", 33931},
-		{"allowdodge", 33933},
-		{"sub_140529860", 33934},
-		{"setminimapvisible", 33935},
-		{"sub_1402e0a90", 33936},
-		{"sub_1402e0bc0", 33937},
-		{"sub_1402e0cf0", 33938},
-		{"setplayermech", 33940},
-		{"setdamagecallbackon", 33941},
-		{"finishentitydamage", 33942},
-		{"designatefoftarget", 33946},
-		{"sethintstringvisibleonlytoowner", 33947},
-		{"notifyonplayercommandremove", 33948},
-		{"sub_1402e3bf0", 33949},
-		{"allowboostjump", 33950},
-		{"batterydischargebegin", 33951},
-		{"batterydischargeend", 33952},
-		{"batterydischargeonce", 33953},
-		{"batterygetcharge", 33954},
-		{"batterysetcharge", 33955},
-		{"batteryfullrecharge", 33956},
-		{"batterygetsize", 33957},
-		{"batterysetdischargescale", 33958},
-		{"batterygetdischargerate", 33959},
-		{"batteryisinuse", 33960},
-		{"enablephysicaldepthoffieldscripting", 33961},
-		{"disablephysicaldepthoffieldscripting", 33962},
-		{"setphysicaldepthoffield", 33963},
-		{"sub_140313860", 33964},
-		{"sub_14052a560", 33965},
-		{"sub_140321790", 33966},
-		{"sub_140321a50", 33967},
-		{"sub_1402dda50", 33968},
-		{"sub_14052ac50", 33969},
-		{"sub_14052ad50", 33970},
-		{"setdemigod", 33971},
-		{"sub_140310840", 33972},
-		{"setcostumemodels", 33978},
-		{"sub_140529e00", 33979},
-		{"sub_140313510", 33980},
-		{"scriptmodelpauseanim", 33981},
-		{"digitaldistortsetmaterial", 33982},
-		{"disableoffhandsecondaryweapons", 33983},
-		{"enableoffhandsecondaryweapons", 33984},
-		{"canplaceriotshield", 33985},
-		{"setriotshieldfailhint", 33986},
-		{"enabledetonate", 33987},
-		{"getdetonateenabled", 33988},
-		{"playergetuseent", 33989},
-		{"refreshshieldmodels", 33990},
-		{"sub_14052c3a0", 33991},
-		{"locret_140406a70", 33993},
-		{"getgravity", 33994},
-		{"sub_140529560", 33997},
-		{"sub_140529650", 33998},
-		{"setcommonplayerdatareservedint", 33999},
-		{"getrankedplayerdatareservedint", 34000},
-		{"setrankedplayerdatareservedint", 34001},
-		{"getcommonplayerdatareservedint", 34002},
-		{"sub_1402e8a20", 34003},
-		{"sub_14052c3c0", 34004},
-		{"addsoundmutedevice", 34005},
-		{"removesoundmutedevice", 34006},
-		{"clientaddsoundsubmix", 34007},
-		{"clientclearsoundsubmix", 34008},
-		{"sub_140312520", 34009},
-		{"sub_140312ba0", 34010},
-		{"sub_140312bf0", 34011},
-		{"sub_140312cb0", 34012},
-		{"sub_140312df0", 34013},
-		{"sub_140312ff0", 34014},
-		{"isusingoffhand", 34016},
-		{"physicsstop", 34017},
-		{"sub_14031b9e0", 34018},
-		{"sub_14031e3c0", 34023},
-		{"sub_1402ef8a0", 34024},
-		{"sub_14052c400", 34025},
-		{"initwaterclienttrigger", 34026},
-		{"getcurrentweaponmodelname", 34027},
-		{"sub_14031f000", 34028},
-		{"setignorefoliagesightingme", 34030},
-		{"loadcostumemodels", 34031},
-		{"sub_14030cd90", 34036},
-		{"sub_14030b1c0", 34038},
-		{"sub_140322450", 34039},
-		{"iscloaked", 34040},
-		{"sub_140528bc0", 34041},
-		{"sub_140528cf0", 34042},
-		{"sub_14031fb80", 34043},
-		{"sub_140320180", 34044},
-		{"selfieaccessselfievalidflaginplayerdef", 34045},
-		{"selfieaccessselfiecustomassetsarestreamed", 34046},
-		{"sub_14031ede0", 34048},
-		{"selfiescreenshottaken", 34049},
-		{"sub_14031f190", 34050},
-		{"sub_140319de0", 34052},
-		{"setmissilecoasting", 34053},
-		{"setmlgspectator", 34054},
-		{"gettotalmpxp", 34055},
-		{"turretsetgroundaimentity", 34056},
-		{"sub_140318610", 34057},
-		{"sub_140317760", 34058},
-		{"sub_14032e9a0", 34059},
-		{"sub_140320830", 34060},
-		{"sub_140329bc0", 34061},
-		{"sub_14032e370", 34062},
-		{"consumereinforcement", 34063},
-		{"ghost", 34064},
-		{"loadweapons", 34065},
-		{"sub_1402e0e80", 34067},
-		{"setwaypointiconfadeatcenter", 34068},
-		{"setreinforcementhintstrings", 34069},
-		{"playgoliathentryanim", 34070},
-		{"playgoliathtoidleanim", 34071},
-		{"sub_140312210", 34072},
-		{"sub_140312280", 34073},
-		{"sub_140321660", 34074},
-		{"playlocalannouncersound", 34075},
-		{"setmissilespecialclipmask", 34076},
-		{"sub_140527c40", 34077},
-		{"sub_140527c60", 34078},
-		{"isdodging", 34079},
-		{"ispowersliding", 34080},
-		{"sub_140320ab0", 34081},
-		{"getcurrentping", 34082},
-		{"sub_1402eeb60", 34083},
-		{"sub_140329390", 34084},
-		{"gethordeplayerdata", 34085},
-		{"sethordeplayerdata", 34086},
-		{"sub_1402dcbc0", 34087},
-		{"sub_14031a0b0", 34088},
-		{"sub_1403198a0", 34089},
-		{"sub_1403345e0", 34090},
-		{"sub_1402e7d80", 34092},
-		{"sub_140404f00", 34093},
-		{"issplitscreenplayer2", 34095},
-		{"setowneroriginal", 34096},
-		{"getlinkedtagname", 34097},
-		{"sub_14032de80", 34098},
-		{"sub_14032dfb0", 34099},
-		{"setwaypointaerialtargeting", 34100},
-		{"worldweaponsloaded", 34101},
-		{"sub_140320aa0", 34102},
-		{"usetriggertouchcheckstance", 34103},
-		{"onlystreamactiveweapon", 34104},
-		{"precachekillcamiconforweapon", 34105},
-		{"selfierequestupdate", 34106},
-		{"getclanwarsbonus", 34107},
-		{"sub_140406810", 34108},
-		{"sub_1404051d0", 34109},
-		{"sub_140406340", 34110},
-		{"sub_1402e72a0", 34111},
-		{"sub_140404c70", 34112},
-		{"sub_1404065c0", 34113},
-		{"sub_140405c60", 34114},
-		{"sub_140406400", 34115},
-		{"sub_140406230", 34116},
-		{"sub_140406650", 34117},
-		{"sub_1402e7de0", 34118},
-		{"sub_140333550", 34119},
-		{"sub_140403fe0", 34120},
-		{"sub_140320360", 34121},
-		{"canhighjump", 34122},
-		{"setprestigemastery", 34123},
-		{"sub_140403f50", 34124},
-		{"sub_14030c7b0", 34125},
-		{"sub_1403206b0", 34126},
-		{"sub_140329960", 34127},
-		{"sub_140328100", 34128},
-		{"sub_140405990", 34129},
-		{"sub_1402e70c0", 34130},
-		{"sub_1403335f0", 34131},
-		{"getcoopplayerdatareservedint", 34132},
-		{"setcoopplayerdatareservedint", 34133},
-		{"sub_140406b50", 34134},
-		{"sub_1402de070", 34135},
-		{"sub_1402e7e40", 34136},
-		{"sub_140329ba0", 34137},
-		{"sub_140405af0", 34138},
-		{"sub_1402e7240", 34139},
-		{"sub_14031a370", 34140},
-		{"sub_140406970", 34141},
-		{"sub_140405b60", 34142},
-		{"sub_140334e10", 34143},
-		{"sub_140320a90", 34144},
-		{"sub_140406c00", 34145},
-		{"sub_140328bf0", 34146},
-		{"sub_1404053e0", 34147},
-		{"sub_140406d20", 34148},
-		{"sub_14032c900", 34149},
-		{"sub_14032c9e0", 34150},
-		{"sub_140044360", 34151},
-		{"sub_140333680", 34152},
-		{"sub_1402e7130", 34153},
-		{"sub_1403294b0", 34154},
-		{"sub_140320b40", 34155},
-		{"sub_140333710", 34156},
-	};
+		constexpr std::pair<std::string_view, unsigned> method_entries[] =
+		{
+			{"addpitch", 33465},
+			{"addroll", 33467},
+			{"addsoundmutedevice", 34005},
+			{"addyaw", 33466},
+			{"adsbuttonpressed", 33598},
+			{"agentcanseesentient", 33678},
+			{"aiphysicstrace", 33765},
+			{"aiphysicstracepassed", 33766},
+			{"allowads", 33536},
+			{"allowboostjump", 33950},
+			{"allowcrouch", 33049},
+			{"allowdodge", 33933},
+			{"allowfire", 33073},
+			{"allowhighjump", 33714},
+			{"allowhighjumpdrop", 33926},
+			{"allowjump", 33537},
+			{"allowladder", 33538},
+			{"allowmantle", 33539},
+			{"allowmelee", 33072},
+			{"allowpowerslide", 33925},
+			{"allowprone", 33050},
+			{"allowspectateteam", 33395},
+			{"allowsprint", 33540},
+			{"allowstand", 33048},
+			{"anyammoforweaponmodes", 33530},
+			{"attach", 32797},
+			{"attachpath", 33405},
+			{"attackbuttonpressed", 33597},
+			{"autoboltmissileeffects", 33889},
+			{"autospotoverlayoff", 32955},
+			{"autospotoverlayon", 32954},
+			{"batterydischargebegin", 33951},
+			{"batterydischargeend", 33952},
+			{"batterydischargeonce", 33953},
+			{"batteryfullrecharge", 33956},
+			{"batterygetcharge", 33954},
+			{"batterygetdischargerate", 33959},
+			{"batterygetsize", 33957},
+			{"batteryisinuse", 33960},
+			{"batterysetcharge", 33955},
+			{"batterysetdischargescale", 33958},
+			{"beginlocationselection", 33563},
+			{"beginmelee", 33692},
+			{"botcanseeentity", 33647},
+			{"botclearbutton", 33663},
+			{"botclearscriptenemy", 33624},
+			{"botclearscriptgoal", 33622},
+			{"botfindnoderandom", 33633},
+			{"botfirstavailablegrenade", 33795},
+			{"botgetdifficulty", 33643},
+			{"botgetdifficultysetting", 33659},
+			{"botgetfovdot", 33651},
+			{"botgetimperfectenemyinfo", 33655},
+			{"botgetnodesonpath", 33648},
+			{"botgetpathdist", 33660},
+			{"botgetpersonality", 33638},
+			{"botgetscriptgoal", 33626},
+			{"botgetscriptgoalnode", 33654},
+			{"botgetscriptgoalradius", 33627},
+			{"botgetscriptgoaltype", 33629},
+			{"botgetscriptgoalyaw", 33628},
+			{"botgetworldclosestedge", 33644},
+			{"botgetworldsize", 33631},
+			{"bothasscriptgoal", 33637},
+			{"botisrandomized", 33661},
+			{"botlookatpoint", 33645},
+			{"botmemoryevent", 33634},
+			{"botnodeavailable", 33632},
+			{"botnodepick", 33636},
+			{"botnodepickmultiple", 33649},
+			{"botnodescoremultiple", 33664},
+			{"botpredictenemycampspots", 33847},
+			{"botpredictseepoint", 33646},
+			{"botpressbutton", 33662},
+			{"botpursuingscriptgoal", 33653},
+			{"botsetattacker", 33625},
+			{"botsetawareness", 33652},
+			{"botsetdifficulty", 33642},
+			{"botsetdifficultysetting", 33658},
+			{"botsetflag", 33617},
+			{"botsetpathingstyle", 33657},
+			{"botsetpersonality", 33641},
+			{"botsetscriptenemy", 33623},
+			{"botsetscriptgoal", 33620},
+			{"botsetscriptgoalnode", 33621},
+			{"botsetscriptmove", 33619},
+			{"botsetstance", 33618},
+			{"botthrowgrenade", 33639},
+			{"buttonpressed", 33356},
+			{"cameralinkto", 33250},
+			{"cameraunlink", 33251},
+			{"cancelmantle", 33849},
+			{"canhighjump", 34122},
+			{"canmantle", 33502},
+			{"canplaceriotshield", 33985},
+			{"canplayerplacesentry", 33490},
+			{"canplayerplacetank", 33491},
+			{"canspawntestclient", 33818},
+			{"canturrettargetpoint", 33380},
+			{"challengenotification", 33859},
+			{"changefontscaleovertime", 32907},
+			{"claimnode", 33697},
+			{"clearentity", 33930},
+			{"cleargoalyaw", 33373},
+			{"clearlookatent", 33382},
+			{"clearlookattarget", 33899},
+			{"clearperks", 33448},
+			{"clearportableradar", 32785},
+			{"clearscrambler", 32784},
+			{"cleartargetent", 32974},
+			{"cleartargetentity", 33032},
+			{"cleartargetyaw", 33375},
+			{"clearthreatdetected", 32777},
+			{"clearturrettargetent", 33379},
+			{"clientaddsoundsubmix", 34007},
+			{"clientclaimtrigger", 32788},
+			{"clientclearsoundsubmix", 34008},
+			{"clientreleasetrigger", 32789},
+			{"clientspawnsighttracepassed", 33535},
+			{"cloakingdisable", 33868},
+			{"cloakingenable", 33867},
+			{"cloneagent", 33677},
+			{"clonebrushmodeltoscriptmodel", 33400},
+			{"cloneplayer", 33393},
+			{"closeingamemenu", 33388},
+			{"closemenu", 33575},
+			{"closepopupmenu", 33573},
+			{"connectnode", 32858},
+			{"connectpaths", 32856},
+			{"consumereinforcement", 34063},
+			{"controlslinkto", 33280},
+			{"controlsunlink", 33281},
+			{"crash", 33324},
+			{"damageconetrace", 33239},
+			{"delete", 32944},
+			{"designatefoftarget", 33946},
+			{"destroy", 32904},
+			{"detach", 32810},
+			{"detachall", 32811},
+			{"detonate", 33238},
+			{"digitaldistortsetmaterial", 33982},
+			{"digitaldistortsetparams", 32868},
+			{"disableaimassist", 33236},
+			{"disableammogeneration", 32781},
+			{"disableautoreload", 33843},
+			{"disablecrashing", 33326},
+			{"disableforcethirdpersonwhenfollowing", 33616},
+			{"disablegrenadetouchdamage", 33204},
+			{"disablemissileboosting", 33816},
+			{"disablemissilestick", 33890},
+			{"disableoffhandsecondaryweapons", 33983},
+			{"disableoffhandweapons", 33567},
+			{"disablephysicaldepthoffieldscripting", 33962},
+			{"disableplayeruse", 32779},
+			{"disableusability", 33578},
+			{"disableweaponpickup", 33483},
+			{"disableweapons", 33565},
+			{"disableweaponswitch", 33569},
+			{"disconnectnode", 32857},
+			{"disconnectpaths", 32855},
+			{"doanimlerp", 33695},
+			{"doanimrelative", 33832},
+			{"dodamage", 32849},
+			{"doesnodeallowstance", 32821},
+			{"dontinterpolate", 32914},
+			{"dospawn", 33322},
+			{"dotrajectory", 33694},
+			{"drivevehicleandcontrolturret", 33291},
+			{"drivevehicleandcontrolturretoff", 33292},
+			{"dropitem", 33360},
+			{"dropscavengerbag", 33361},
+			{"emissiveblend", 33801},
+			{"enableaimassist", 33205},
+			{"enableammogeneration", 32780},
+			{"enableanimstate", 33745},
+			{"enableautoreload", 33844},
+			{"enablecrashing", 33327},
+			{"enabledetonate", 33987},
+			{"enablegrenadetouchdamage", 33203},
+			{"enablelinkto", 32873},
+			{"enablemissileboosting", 33817},
+			{"enablemissilestick", 33891},
+			{"enablemousesteer", 33612},
+			{"enableoffhandsecondaryweapons", 33984},
+			{"enableoffhandweapons", 33568},
+			{"enablephysicaldepthoffieldscripting", 33961},
+			{"enableplayeruse", 32778},
+			{"enableusability", 33579},
+			{"enableweaponpickup", 33484},
+			{"enableweapons", 33566},
+			{"enableweaponswitch", 33570},
+			{"endlocationselection", 33564},
+			{"entityradiusdamage", 33237},
+			{"entitywillneverchange", 32993},
+			{"fadeoutshellshock", 33157},
+			{"fadeovertime", 32900},
+			{"finishagentdamage", 33675},
+			{"finishdamage", 33410},
+			{"finishentitydamage", 33942},
+			{"finishplayerdamage", 33386},
+			{"fireweapon", 33384},
+			{"forcemantle", 33503},
+			{"forcespectatepov", 33396},
+			{"forcethirdpersonwhenfollowing", 33615},
+			{"forceusehintoff", 32990},
+			{"forceusehinton", 32989},
+			{"fragbuttonpressed", 33518},
+			{"freeentitysentient", 33082},
+			{"freevehicle", 33330},
+			{"freezecontrols", 33577},
+			{"getammocount", 33151},
+			{"getangles", 33595},
+			{"getanimentry", 33747},
+			{"getanimentryalias", 33749},
+			{"getanimentrycount", 33750},
+			{"getanimentryname", 33748},
+			{"getattachignorecollision", 32839},
+			{"getattachmodelname", 32813},
+			{"getattachpos", 33406},
+			{"getattachsize", 32812},
+			{"getattachtagname", 32814},
+			{"getbarrelspinrate", 32999},
+			{"getbodyvelocity", 33416},
+			{"getbraggingright", 33719},
+			{"getcacplayerdata", 33352},
+			{"getcacplayerdataforgroup", 33866},
+			{"getclanidhigh", 33434},
+			{"getclanidlow", 33435},
+			{"getclanwarsbonus", 34107},
+			{"getclientomnvar", 33863},
+			{"getclosestenemysqdist", 33142},
+			{"getcommonplayerdata", 33318},
+			{"getcommonplayerdatareservedint", 34002},
+			{"getcoopplayerdata", 33317},
+			{"getcoopplayerdatareservedint", 34132},
+			{"getcorpseanim", 32795},
+			{"getcorpseentity", 33836},
+			{"getcurrentoffhand", 33555},
+			{"getcurrentping", 34082},
+			{"getcurrentprimaryweapon", 33554},
+			{"getcurrentweapon", 33553},
+			{"getcurrentweaponclipammo", 33520},
+			{"getcurrentweaponmodelname", 34027},
+			{"getdetonateenabled", 33988},
+			{"getenemyinfo", 33125},
+			{"getenemysqdist", 33141},
+			{"getentitynumber", 33201},
+			{"getentityvelocity", 33202},
+			{"geteye", 32936},
+			{"getfireteammembers", 33451},
+			{"getfractionmaxammo", 33588},
+			{"getfractionstartammo", 33587},
+			{"getgoalpos", 33681},
+			{"getgoalspeedmph", 33422},
+			{"getgravity", 33994},
+			{"getguid", 33397},
+			{"gethighestnodestance", 32820},
+			{"gethordeplayerdata", 34085},
+			{"getistouchingentities", 32938},
+			{"getlightcolor", 32835},
+			{"getlightintensity", 33246},
+			{"getlinkedchildren", 33846},
+			{"getlinkedparent", 33772},
+			{"getlinkedtagname", 34097},
+			{"getlocalplayerprofiledata", 33294},
+			{"getlookaheaddir", 33760},
+			{"getmaxturnspeed", 33691},
+			{"getmode", 32870},
+			{"getmodelfromentity", 33720},
+			{"getmotiontrackervisible", 33299},
+			{"getmovingplatformparent", 33773},
+			{"getnearestnode", 33671},
+			{"getnegotiationendnode", 33182},
+			{"getnegotiationnextnode", 33183},
+			{"getnegotiationstartnode", 33181},
+			{"getnodenumber", 33665},
+			{"getnormalhealth", 32891},
+			{"getnormalizedcameramovement", 33549},
+			{"getnormalizedmovement", 33523},
+			{"getoffhandprimaryclass", 33605},
+			{"getoffhandsecondaryclass", 33562},
+			{"getorigin", 32917},
+			{"getpathgoalpos", 33761},
+			{"getplayerdata", 33314},
+			{"getplayerknifemodel", 33499},
+			{"getplayersetting", 33293},
+			{"getplayerssightingme", 33516},
+			{"getplayerweaponmodel", 33498},
+			{"getpointinbounds", 33302},
+			{"getprivateplayerdata", 33316},
+			{"getrankedplayerdata", 33315},
+			{"getrankedplayerdatareservedint", 34000},
+			{"getrestedtime", 32792},
+			{"getsightedplayers", 33515},
+			{"getspectatingplayer", 33437},
+			{"getspeed", 33414},
+			{"getstance", 33148},
+			{"getsteering", 33417},
+			{"gettagangles", 33153},
+			{"gettagorigin", 33152},
+			{"getthirdpersoncrosshairoffset", 33482},
+			{"getthreatbiasgroup", 33144},
+			{"getthrottle", 33418},
+			{"gettotalmpxp", 34055},
+			{"getturretowner", 33003},
+			{"getturrettarget", 33033},
+			{"getucdidhigh", 33432},
+			{"getucdidlow", 33433},
+			{"getunnormalizedcameramovement", 33869},
+			{"getvehicleowner", 33367},
+			{"getvehvelocity", 33415},
+			{"getvelocity", 33593},
+			{"getviewheight", 33522},
+			{"getviewkickscale", 33546},
+			{"getviewmodel", 33517},
+			{"getvieworigin", 33884},
+			{"getweaponammoclip", 33528},
+			{"getweaponammostock", 33529},
+			{"getweaponheatlevel", 33721},
+			{"getweaponhudiconoverride", 33308},
+			{"getweaponslist", 33489},
+			{"getweaponslistall", 33547},
+			{"getweaponslistexclusives", 33488},
+			{"getweaponslistitems", 33487},
+			{"getweaponslistoffhands", 33486},
+			{"getweaponslistprimaries", 33548},
+			{"getwheelsurface", 33366},
+			{"getxuid", 33431},
+			{"ghost", 34064},
+			{"giveachievement", 33017},
+			{"givemaxammo", 33586},
+			{"givestartammo", 33585},
+			{"giveweapon", 33550},
+			{"gravitymove", 33458},
+			{"hasfemalecustomizationmodel", 33850},
+			{"hasloadedcustomizationplayerview", 33829},
+			{"hasperk", 33447},
+			{"hasweapon", 33556},
+			{"heli_setdamagestage", 32770},
+			{"helisetgoal", 33376},
+			{"hide", 32852},
+			{"hideallparts", 32842},
+			{"hidepart", 32840},
+			{"hidepartallinstances", 32841},
+			{"hideviewmodel", 33922},
+			{"hudoutlinedisable", 33787},
+			{"hudoutlinedisableforclient", 33825},
+			{"hudoutlinedisableforclients", 33827},
+			{"hudoutlineenable", 33786},
+			{"hudoutlineenableforclient", 33824},
+			{"hudoutlineenableforclients", 33826},
+			{"iclientprintln", 33389},
+			{"iclientprintlnbold", 33390},
+			{"initwaterclienttrigger", 34026},
+			{"iscloaked", 34040},
+			{"isdodging", 34079},
+			{"isdualwielding", 33589},
+			{"isfiring", 33069},
+			{"isfiringturret", 32996},
+			{"isfiringvehicleturret", 33288},
+			{"ishighjumping", 33716},
+			{"ishost", 33436},
+			{"isitemunlocked", 33313},
+			{"isjumping", 33715},
+			{"islinked", 32872},
+			{"ismantling", 33504},
+			{"ismeleeing", 33070},
+			{"ismlgspectator", 33842},
+			{"isoffhandweaponreadytothrow", 33893},
+			{"isonground", 33601},
+			{"isonladder", 32794},
+			{"isphysveh", 33323},
+			{"ispowersliding", 34080},
+			{"isragdoll", 33248},
+			{"isreloading", 33590},
+			{"isshiftbuttonpresseddown", 33723},
+			{"issighted", 33514},
+			{"issplitscreenplayer", 33485},
+			{"issplitscreenplayer2", 34095},
+			{"issplitscreenplayerprimary", 33512},
+			{"issprinting", 33752},
+			{"isswitchingweapon", 33591},
+			{"istalking", 33394},
+			{"isthrowinggrenade", 33068},
+			{"istouching", 32937},
+			{"isturretoverheated", 33871},
+			{"isturretready", 33320},
+			{"isusingoffhand", 34016},
+			{"isusingonlinedataoffline", 32791},
+			{"isusingturret", 33602},
+			{"isweaponoverheated", 33722},
+			{"itemweaponsetammo", 33150},
+			{"joltbody", 33364},
+			{"jumpbuttonpressed", 33758},
+			{"kc_regweaponforfxremoval", 33478},
+			{"laseroff", 32947},
+			{"laseron", 32946},
+			{"lastknownpos", 33217},
+			{"lastknowntime", 33216},
+			{"laststand", 33480},
+			{"laststandrevive", 33479},
+			{"launch", 33325},
+			{"lerpviewangleclamp", 32930},
+			{"lightsetforplayer", 33728},
+			{"lightsetoverridedisableforplayer", 33730},
+			{"lightsetoverrideenableforplayer", 33729},
+			{"linkto", 32845},
+			{"linktoblendtotag", 32846},
+			{"linktosynchronizedparent", 33862},
+			{"linkwaypointtotargetwithoffset", 33771},
+			{"loadcostumemodels", 34031},
+			{"loadcustomizationplayerview", 33820},
+			{"loadweapons", 34065},
+			{"localtoworldcoords", 33200},
+			{"locret_140406a70", 33993},
+			{"logmatchdatadeath", 33839},
+			{"logmatchdatalife", 33838},
+			{"makecollidewithitemclip", 33895},
+			{"makeentitynomeleetarget", 33672},
+			{"makeentitysentient", 33081},
+			{"makeglobalunusable", 32962},
+			{"makeglobalusable", 32961},
+			{"makehard", 32992},
+			{"makeportableradar", 32783},
+			{"makescrambler", 32782},
+			{"makesoft", 32991},
+			{"maketurretinoperable", 33080},
+			{"maketurretoperable", 33079},
+			{"maketurretsolid", 33078},
+			{"makeunusable", 32960},
+			{"makeusable", 32959},
+			{"makevehiclenotcollidewithplayers", 33779},
+			{"makevehiclesolidcapsule", 33282},
+			{"makevehiclesolidsphere", 33284},
+			{"markforeyeson", 33513},
+			{"meleebuttonpressed", 33599},
+			{"missilecleartarget", 33243},
+			{"missilesetflightmodedirect", 33244},
+			{"missilesetflightmodetop", 33245},
+			{"missilesettargetent", 33241},
+			{"missilesettargetpos", 33242},
+			{"moveovertime", 32902},
+			{"moveslide", 33459},
+			{"moveto", 33454},
+			{"movex", 33455},
+			{"movey", 33456},
+			{"movez", 33457},
+			{"neargoalnotifydist", 33370},
+			{"nodeisdisconnected", 33670},
+			{"notifyonplayercommand", 33501},
+			{"notifyonplayercommandremove", 33948},
+			{"notsolid", 33471},
+			{"onlystreamactiveweapon", 34104},
+			{"openmenu", 33574},
+			{"openpopupmenu", 33571},
+			{"openpopupmenunomouse", 33572},
+			{"physicsgetangspeed", 33815},
+			{"physicsgetangvel", 33814},
+			{"physicsgetlinspeed", 33813},
+			{"physicsgetlinvel", 33812},
+			{"physicslaunchclient", 33474},
+			{"physicslaunchserver", 33398},
+			{"physicslaunchserveritem", 33399},
+			{"physicssetmaxangvel", 33811},
+			{"physicssetmaxlinvel", 33810},
+			{"physicsstop", 34017},
+			{"pingplayer", 33355},
+			{"placespawnpoint", 32786},
+			{"playerads", 33600},
+			{"playerforcedeathanim", 32796},
+			{"playergetuseent", 33989},
+			{"playerhide", 32773},
+			{"playerlinkedoffsetdisable", 32927},
+			{"playerlinkedoffsetenable", 32897},
+			{"playerlinkedsetusebaseangleforviewclamp", 32929},
+			{"playerlinkedsetviewznear", 32928},
+			{"playerlinkto", 32892},
+			{"playerlinktoabsolute", 32895},
+			{"playerlinktoblend", 32896},
+			{"playerlinktodelta", 32893},
+			{"playerlinkweaponviewtodelta", 32894},
+			{"playerrecoilscaleoff", 33507},
+			{"playerrecoilscaleon", 33506},
+			{"playersetatmosfog", 33312},
+			{"playersetexpfog", 33311},
+			{"playersetexpfogext", 33310},
+			{"playersetgroundreferenceent", 32913},
+			{"playershow", 32774},
+			{"playfx", 33505},
+			{"playgoliathentryanim", 34070},
+			{"playgoliathtoidleanim", 34071},
+			{"playlocalannouncersound", 34075},
+			{"playlocalsound", 33524},
+			{"playloopsound", 32885},
+			{"playrumblelooponentity", 32942},
+			{"playrumbleonentity", 32941},
+			{"playsound", 32884},
+			{"playsoundasmaster", 32922},
+			{"playsoundonmovingent", 33848},
+			{"playsoundtoplayer", 32772},
+			{"playsoundtoteam", 32771},
+			{"precachekillcamiconforweapon", 34105},
+			{"predictstreampos", 33438},
+			{"queuedialogforplayer", 33840},
+			{"refreshshieldmodels", 33990},
+			{"registerparty", 33450},
+			{"releaseclaimedtrigger", 32790},
+			{"relinquishclaimednode", 33698},
+			{"remotecamerasoundscapeoff", 33297},
+			{"remotecamerasoundscapeon", 33296},
+			{"remotecontrolturret", 33000},
+			{"remotecontrolturretoff", 33001},
+			{"remotecontrolvehicle", 33286},
+			{"remotecontrolvehicleoff", 33287},
+			{"remotecontrolvehicletarget", 33289},
+			{"remotecontrolvehicletargetoff", 33290},
+			{"removesoundmutedevice", 34006},
+			{"reset", 32903},
+			{"resetspreadoverride", 33542},
+			{"restoredefaultdroppitch", 33115},
+			{"resumespeed", 33425},
+			{"ridevehicle", 33886},
+			{"rotateby", 33759},
+			{"rotatepitch", 33462},
+			{"rotateroll", 33464},
+			{"rotateto", 33461},
+			{"rotatevehyaw", 33413},
+			{"rotatevelocity", 33469},
+			{"rotateyaw", 33463},
+			{"sayall", 33357},
+			{"sayteam", 33358},
+			{"scaleovertime", 32901},
+			{"scalepitch", 32877},
+			{"scalevolume", 32879},
+			{"scriptmodelclearanim", 33402},
+			{"scriptmodelpauseanim", 33981},
+			{"scriptmodelplayanim", 33401},
+			{"scriptmodelplayanimdeltamotion", 33403},
+			{"secondaryoffhandbuttonpressed", 33519},
+			{"selfieaccessselfiecustomassetsarestreamed", 34046},
+			{"selfieaccessselfievalidflaginplayerdef", 34045},
+			{"selfierequestupdate", 34106},
+			{"selfiescreenshottaken", 34049},
+			{"sendleaderboards", 32793},
+			{"setacceleration", 33423},
+			{"setactionslot", 33544},
+			{"setagentattacker", 33676},
+			{"setagentwaypoint", 33679},
+			{"setaimspreadmovementscale", 33543},
+			{"setairresitance", 33429},
+			{"setaisightlinevisible", 33668},
+			{"setaispread", 33035},
+			{"setangles", 33594},
+			{"setanimclass", 33744},
+			{"setanimmode", 33687},
+			{"setanimscale", 33685},
+			{"setanimstate", 33746},
+			{"setautorotationdelay", 33113},
+			{"setblurforplayer", 33497},
+			{"setbottomarc", 33112},
+			{"setcacplayerdata", 33353},
+			{"setcandamage", 33472},
+			{"setcanradiusdamage", 33473},
+			{"setcarddisplayslot", 33477},
+			{"setchannelvolume", 33584},
+			{"setclientdvar", 33532},
+			{"setclientdvars", 33533},
+			{"setclientomnvar", 33531},
+			{"setclientowner", 33666},
+			{"setclientspawnsighttraces", 33534},
+			{"setclienttriggervisionset", 33914},
+			{"setclipmode", 33689},
+			{"setclock", 32981},
+			{"setclockup", 32982},
+			{"setcommonplayerdata", 33351},
+			{"setcommonplayerdatareservedint", 33999},
+			{"setcontents", 32958},
+			{"setconvergenceheightpercent", 33076},
+			{"setconvergencetime", 33075},
+			{"setconveyorbelt", 33329},
+			{"setcoopplayerdata", 33350},
+			{"setcoopplayerdatareservedint", 34133},
+			{"setcorpsefalling", 33763},
+			{"setcostumemodels", 33978},
+			{"setcursorhint", 32986},
+			{"setdamagecallbackon", 33941},
+			{"setdeceleration", 33424},
+			{"setdefaultdroppitch", 33114},
+			{"setdemigod", 33971},
+			{"setdepthoffield", 33158},
+			{"setdronegoalpos", 33785},
+			{"setempjammed", 33309},
+			{"setentertime", 33392},
+			{"setentityowner", 33669},
+			{"seteyesonuplinkenabled", 32956},
+			{"setfxkilldefondelete", 33853},
+			{"setgoalentity", 33683},
+			{"setgoalnode", 33682},
+			{"setgoalpos", 33680},
+			{"setgoalradius", 33684},
+			{"setgoalyaw", 33372},
+			{"setgrenadecookscale", 33822},
+			{"setgrenadethrowscale", 33821},
+			{"sethintstring", 32987},
+			{"sethintstringvisibleonlytoowner", 33947},
+			{"sethordeplayerdata", 34086},
+			{"sethoverparams", 33363},
+			{"setignorefoliagesightingme", 34030},
+			{"setjitterparams", 33362},
+			{"setleftarc", 33110},
+			{"setlightcolor", 32836},
+			{"setlightintensity", 33247},
+			{"setlocalplayerprofiledata", 33295},
+			{"setlookatent", 33381},
+			{"setlookattarget", 33898},
+			{"setmaterial", 32972},
+			{"setmaxpitchroll", 33428},
+			{"setmaxturnspeed", 33690},
+			{"setminimapvisible", 33935},
+			{"setmissilecoasting", 34053},
+			{"setmissileminimapvisible", 33892},
+			{"setmissilespecialclipmask", 34076},
+			{"setmlgcameradefaults", 33841},
+			{"setmlgspectator", 34054},
+			{"setmode", 32869},
+			{"setmodel", 32945},
+			{"setmotionblurmovescale", 33160},
+			{"setmotionblurturnscale", 33197},
+			{"setmotionblurzoomscale", 33198},
+			{"setmotiontrackervisible", 33298},
+			{"setmovespeedscale", 33249},
+			{"setnameplatematerial", 33774},
+			{"setnormalhealth", 32848},
+			{"setoffhandprimaryclass", 33604},
+			{"setoffhandsecondaryclass", 33561},
+			{"setorientmode", 33686},
+			{"setorigin", 33592},
+			{"setotherent", 33667},
+			{"setowneroriginal", 34096},
+			{"setperk", 33446},
+			{"setphysicaldepthoffield", 33963},
+			{"setphysicsmode", 33688},
+			{"setphysvehspeed", 33328},
+			{"setpickupweapon", 33923},
+			{"setpitch", 32876},
+			{"setplanesplineid", 33823},
+			{"setplayerdata", 33347},
+			{"setplayermech", 33940},
+			{"setplayernamestring", 32906},
+			{"setplayerspread", 33034},
+			{"setprestigemastery", 34123},
+			{"setprivateplayerdata", 33349},
+			{"setpulsefx", 32905},
+			{"setradarping", 33699},
+			{"setrank", 33441},
+			{"setrankedplayerdata", 33348},
+			{"setrankedplayerdatareservedint", 34001},
+			{"setreinforcementhintstrings", 34069},
+			{"setrightarc", 33109},
+			{"setriotshieldfailhint", 33986},
+			{"setscriptabledamageowner", 33852},
+			{"setscriptablepartstate", 33782},
+			{"setscripted", 33693},
+			{"setscriptmoverkillcam", 33613},
+			{"setsecondaryhintstring", 32988},
+			{"setsentrycarrier", 33028},
+			{"setsentryowner", 33027},
+			{"setspawnweapon", 33359},
+			{"setspectatedefaults", 33481},
+			{"setspeed", 33411},
+			{"setspeedimmediate", 33412},
+			{"setspreadoverride", 33541},
+			{"setstance", 33149},
+			{"setsuppressiontime", 33036},
+			{"setsurfacetype", 33764},
+			{"setswitchnode", 33408},
+			{"settargetent", 32973},
+			{"settargetentity", 33030},
+			{"settargetyaw", 33374},
+			{"setteamfortrigger", 32787},
+			{"settenthstimer", 32978},
+			{"settenthstimerstatic", 32980},
+			{"settenthstimerup", 32979},
+			{"settext", 32970},
+			{"setthreatbiasgroup", 33143},
+			{"settimer", 32975},
+			{"settimerstatic", 32977},
+			{"settimerup", 32976},
+			{"settoparc", 33111},
+			{"setturningability", 33430},
+			{"setturretminimapvisible", 33029},
+			{"setturretmodechangewait", 33146},
+			{"setturrettargetent", 33378},
+			{"setturrettargetvec", 33377},
+			{"setturretteam", 33077},
+			{"setvalue", 32983},
+			{"setvehgoalpos", 33371},
+			{"setvehiclelookattext", 33368},
+			{"setvehicleteam", 33369},
+			{"setvelocity", 33521},
+			{"setviewheight", 33696},
+			{"setviewkickscale", 33545},
+			{"setviewmodel", 33603},
+			{"setviewmodeldepthoffield", 33159},
+			{"setvolume", 32878},
+			{"setwaitspeed", 33409},
+			{"setwatersheeting", 33304},
+			{"setwaypoint", 32984},
+			{"setwaypointaerialtargeting", 34100},
+			{"setwaypointedgestyle_rotatingicon", 32985},
+			{"setwaypointedgestyle_secondaryarrow", 32898},
+			{"setwaypointiconfadeatcenter", 34068},
+			{"setwaypointiconoffscreenonly", 32899},
+			{"setweapon", 33383},
+			{"setweaponammoclip", 33526},
+			{"setweaponammostock", 33527},
+			{"setweaponhudiconoverride", 33307},
+			{"setweaponmodelvariant", 33885},
+			{"setwhizbyradii", 33581},
+			{"setwhizbyspreads", 33580},
+			{"setyawspeed", 33426},
+			{"setyawspeedbyname", 33427},
+			{"shellshock", 33154},
+			{"shootturret", 33002},
+			{"show", 32851},
+			{"showallparts", 32844},
+			{"showhudsplash", 33445},
+			{"showpart", 32843},
+			{"showtoplayer", 32775},
+			{"showviewmodel", 33921},
+			{"sightconetrace", 33240},
+			{"snaptotargetentity", 33031},
+			{"solid", 33470},
+			{"spawn", 33391},
+			{"spawnagent", 33674},
+			{"spawntestclient", 33819},
+			{"startbarrelspin", 32997},
+			{"startfiring", 32994},
+			{"startpath", 33407},
+			{"startragdoll", 32803},
+			{"stopbarrelspin", 32998},
+			{"stopfiring", 32995},
+			{"stoplocalsound", 33525},
+			{"stoploopsound", 32939},
+			{"stopmoveslide", 33460},
+			{"stopridingvehicle", 33887},
+			{"stoprumble", 32943},
+			{"stopshellshock", 33156},
+			{"stopsliding", 33783},
+			{"stopsounds", 32940},
+			{"stunplayer", 33155},
+			{"sub_140043710", 33732},
+			{"sub_140044360", 34151},
+			{"sub_1402dcbc0", 34087},
+			{"sub_1402dd560", 33704},
+			{"sub_1402dd590", 33705},
+			{"sub_1402dd9e0", 33051},
+			{"sub_1402dda50", 33968},
+			{"sub_1402ddb00", 33022},
+			{"sub_1402ddcc0", 33023},
+			{"sub_1402ddd70", 33734},
+			{"sub_1402de070", 34135},
+			{"sub_1402de140", 33879},
+			{"sub_1402e0a90", 33936},
+			{"sub_1402e0bc0", 33937},
+			{"sub_1402e0cf0", 33938},
+			{"sub_1402e0e80", 34067},
+			{"sub_1402e1b80", 33856},
+			{"sub_1402e1d60", 33559},
+			{"sub_1402e3bf0", 33949},
+			{"sub_1402e41c0", 33917},
+			{"sub_1402e43b0", 33918},
+			{"sub_1402e66d0", 33804},
+			{"sub_1402e66e0", 33805},
+			{"sub_1402e66f0", 33806},
+			{"sub_1402e6bb0", 33851},
+			{"sub_1402e70c0", 34130},
+			{"sub_1402e7130", 34153},
+			{"sub_1402e7240", 34139},
+			{"sub_1402e72a0", 34111},
+			{"sub_1402e7d80", 34092},
+			{"sub_1402e7de0", 34118},
+			{"sub_1402e7e40", 34136},
+			{"sub_1402e8a20", 34003},
+			{"sub_1402eeb60", 34083},
+			{"sub_1402ef480", 33701},
+			{"sub_1402ef4e0", 33702},
+			{"sub_1402ef8a0", 34024},
+			{"sub_14030b1c0", 34038},
+			{"sub_14030c7b0", 34125},
+			{"sub_14030cd90", 34036},
+			{"sub_140310840", 33972},
+			{"sub_140310fb0", 33858},
+			{"sub_140312210", 34072},
+			{"sub_140312280", 34073},
+			{"sub_140312520", 34009},
+			{"sub_140312ba0", 34010},
+			{"sub_140312bf0", 34011},
+			{"sub_140312cb0", 34012},
+			{"sub_140312df0", 34013},
+			{"sub_140312ff0", 34014},
+			{"sub_1403131d0", 33778},
+			{"sub_140313420", 33830},
+			{"sub_140313510", 33980},
+			{"sub_1403136f0", 33831},
+			{"sub_140313860", 33964},
+			{"sub_140313d20", 33777},
+			{"sub_140316940", 33762},
+			{"sub_140316a60", 33784},
+			{"sub_140317760", 34058},
+			{"sub_140318610", 34057},
+			{"sub_1403198a0", 34089},
+			{"sub_140319de0", 34052},
+			{"sub_14031a0b0", 34088},
+			{"sub_14031a370", 34140},
+			{"sub_14031b9e0", 34018},
+			{"sub_14031c170", 33912},
+			{"sub_14031c590", 33913},
+			{"sub_14031e3c0", 34023},
+			{"sub_14031ede0", 34048},
+			{"sub_14031edf0", 33870},
+			{"sub_14031f000", 34028},
+			{"sub_14031f190", 34050},
+			{"sub_14031fb80", 34043},
+			{"sub_140320180", 34044},
+			{"sub_140320360", 34121},
+			{"sub_1403206b0", 34126},
+			{"sub_140320830", 34060},
+			{"sub_140320a90", 34144},
+			{"sub_140320aa0", 34102},
+			{"sub_140320ab0", 34081},
+			{"sub_140320b40", 34155},
+			{"sub_140321660", 34074},
+			{"sub_140321790", 33966},
+			{"sub_140321a50", 33967},
+			{"sub_140322450", 34039},
+			{"sub_140328100", 34128},
+			{"sub_140328bf0", 34146},
+			{"sub_140329390", 34084},
+			{"sub_1403294b0", 34154},
+			{"sub_140329960", 34127},
+			{"sub_140329ba0", 34137},
+			{"sub_140329bc0", 34061},
+			{"sub_14032c900", 34149},
+			{"sub_14032c9e0", 34150},
+			{"sub_14032de80", 34098},
+			{"sub_14032dfb0", 34099},
+			{"sub_14032dff0", 33610},
+			{"sub_14032e040", 33611},
+			{"sub_14032e370", 34062},
+			{"sub_14032e9a0", 34059},
+			{"sub_140333550", 34119},
+			{"sub_1403335f0", 34131},
+			{"sub_140333680", 34152},
+			{"sub_140333710", 34156},
+			{"sub_140333c10", 33731},
+			{"sub_1403345e0", 34090},
+			{"sub_140334a40", 33931},
+			{"sub_140334e10", 34143},
+			{"sub_140403f50", 34124},
+			{"sub_140403fe0", 34120},
+			{"sub_1404045e0", 33927},
+			{"sub_140404c70", 34112},
+			{"sub_140404f00", 34093},
+			{"sub_1404051d0", 34109},
+			{"sub_1404053e0", 34147},
+			{"sub_140405990", 34129},
+			{"sub_140405af0", 34138},
+			{"sub_140405b60", 34142},
+			{"sub_140405c60", 34114},
+			{"sub_140406230", 34116},
+			{"sub_140406340", 34110},
+			{"sub_140406400", 34115},
+			{"sub_1404065c0", 34113},
+			{"sub_140406650", 34117},
+			{"sub_140406810", 34108},
+			{"sub_140406970", 34141},
+			{"sub_140406b50", 34134},
+			{"sub_140406c00", 34145},
+			{"sub_140406d20", 34148},
+			{"sub_140527c40", 34077},
+			{"sub_140527c60", 34078},
+			{"sub_140528300", 33860},
+			{"sub_140528bc0", 34041},
+			{"sub_140528cf0", 34042},
+			{"sub_140529560", 33997},
+			{"sub_140529650", 33998},
+			{"sub_1405297e0", 33928},
+			{"sub_140529860", 33934},
+			{"sub_140529a10", 33717},
+			{"sub_140529a20", 33718},
+			{"sub_140529e00", 33979},
+			{"sub_14052a560", 33965},
+			{"sub_14052ac50", 33969},
+			{"sub_14052ad50", 33970},
+			{"sub_14052b420", 33733},
+			{"sub_14052b4d0", 33919},
+			{"sub_14052b550", 33920},
+			{"sub_14052be00", 33724},
+			{"sub_14052beb0", 33725},
+			{"sub_14052bf30", 33726},
+			{"sub_14052bff0", 33861},
+			{"sub_14052c0b0", 33878},
+			{"sub_14052c170", 33872},
+			{"sub_14052c190", 33873},
+			{"sub_14052c1b0", 33874},
+			{"sub_14052c1d0", 33875},
+			{"sub_14052c200", 33929},
+			{"sub_14052c250", 33907},
+			{"sub_14052c290", 33908},
+			{"sub_14052c2f0", 33909},
+			{"sub_14052c340", 33910},
+			{"sub_14052c360", 33911},
+			{"sub_14052c3a0", 33991},
+			{"sub_14052c3c0", 34004},
+			{"sub_14052c400", 34025},
+			{"suicide", 33387},
+			{"switchtooffhand", 33560},
+			{"switchtoweapon", 33557},
+			{"switchtoweaponimmediate", 33558},
+			{"takeallweapons", 33552},
+			{"takeweapon", 33551},
+			{"teleport", 33404},
+			{"thermaldrawdisable", 32768},
+			{"thermaldrawenable", 32809},
+			{"thermalvisionfofoverlayoff", 32953},
+			{"thermalvisionfofoverlayon", 32952},
+			{"thermalvisionoff", 32951},
+			{"thermalvisionon", 32950},
+			{"threatdetectedtoplayer", 32776},
+			{"trackerupdate", 33354},
+			{"transfermarkstonewscriptmodel", 33303},
+			{"turnengineoff", 33419},
+			{"turnengineon", 33420},
+			{"turretfiredisable", 33116},
+			{"turretfireenable", 33145},
+			{"turretsetbarrelspinenabled", 33828},
+			{"turretsetgroundaimentity", 34056},
+			{"unlink", 32847},
+			{"unsetperk", 33449},
+			{"usebuttonpressed", 33596},
+			{"useby", 32921},
+			{"usetriggerrequirelookat", 33147},
+			{"usetriggertouchcheckstance", 34103},
+			{"usinggamepad", 33614},
+			{"vehicledriveto", 33321},
+			{"vehicleturretcontroloff", 33319},
+			{"vehicleturretcontrolon", 33385},
+			{"vibrate", 33468},
+			{"viewkick", 33199},
+			{"visionsetmissilecamforplayer", 33494},
+			{"visionsetnakedforplayer", 33492},
+			{"visionsetnightforplayer", 33493},
+			{"visionsetpainforplayer", 33496},
+			{"visionsetpostapplyforplayer", 33897},
+			{"visionsetstage", 33770},
+			{"visionsetthermalforplayer", 33495},
+			{"visionsyncwithplayer", 33444},
+			{"visitfxent", 33700},
+			{"weaponlockfinalize", 33509},
+			{"weaponlockfree", 33510},
+			{"weaponlocknoclearance", 33443},
+			{"weaponlockstart", 33508},
+			{"weaponlocktargettooclose", 33511},
+			{"worldpointinreticle_circle", 33300},
+			{"worldpointinreticle_rect", 33301},
+			{"worldpointtoscreenpos", 33792},
+			{"worldweaponsloaded", 34101}
+		};
 
-	std::unordered_map<std::string, unsigned> token_map =
-	{
-		{"CodeCallback_BulletHitEntity", 180},
-		{"CodeCallback_CodeEndGame", 181},
-		{"CodeCallback_EntityDamage", 182},
-		{"CodeCallback_EntityOutOfWorld", 183},
-		{"CodeCallback_HostMigration", 185},
-		{"CodeCallback_PartyMembers", 187},
-		{"CodeCallback_PlayerConnect", 188},
-		{"CodeCallback_PlayerDamage", 189},
-		{"CodeCallback_PlayerDisconnect", 190},
-		{"CodeCallback_PlayerGrenadeSuicide", 191},
-		{"CodeCallback_PlayerKilled", 192},
-		{"CodeCallback_PlayerLastStand", 193},
-		{"CodeCallback_PlayerMigrated", 194},
-		{"CodeCallback_StartGameType", 195},
-		{"CodeCallback_VehicleDamage", 196},
-		{"CreateStruct", 221},
-		{"InitStructs", 522},
-		{"main", 619},
-		{"AbortLevel", 1727},
-		{"callbackVoid", 6662},
-		{"CodeCallback_GiveKillstreak", 8192},
-		{"SetDefaultCallbacks", 32577},
-		{"SetupCallbacks", 33531},
-		{"SetupDamageFlags", 33542},
-		{"struct", 36698},
-		{"codescripts/delete", 0x053D},
-		{"codescripts/struct", 0x053E},
-		{"maps/mp/gametypes/_callbacksetup", 0x0540},
-		{"codescripts/character", 0xA4E5},
-		{"common_scripts/_artcommon", 42214},
-		{"common_scripts/_bcs_location_trigs", 42215},
-		{"common_scripts/_createfx", 42216},
-		{"common_scripts/_createfxmenu", 42217},
-		{"common_scripts/_destructible", 42218},
-		{"common_scripts/_dynamic_world", 42219},
-		{"maps/createart/mp_vlobby_room_art", 42735},
-		{"maps/createart/mp_vlobby_room_fog", 42736},
-		{"maps/createart/mp_vlobby_room_fog_hdr", 42737}
-	};
+		constexpr std::pair<std::string_view, unsigned> token_entries[] =
+		{
+			{"AbortLevel", 1727},
+			{"CodeCallback_BulletHitEntity", 180},
+			{"CodeCallback_CodeEndGame", 181},
+			{"CodeCallback_EntityDamage", 182},
+			{"CodeCallback_EntityOutOfWorld", 183},
+			{"CodeCallback_GiveKillstreak", 8192},
+			{"CodeCallback_HostMigration", 185},
+			{"CodeCallback_PartyMembers", 187},
+			{"CodeCallback_PlayerConnect", 188},
+			{"CodeCallback_PlayerDamage", 189},
+			{"CodeCallback_PlayerDisconnect", 190},
+			{"CodeCallback_PlayerGrenadeSuicide", 191},
+			{"CodeCallback_PlayerKilled", 192},
+			{"CodeCallback_PlayerLastStand", 193},
+			{"CodeCallback_PlayerMigrated", 194},
+			{"CodeCallback_StartGameType", 195},
+			{"CodeCallback_VehicleDamage", 196},
+			{"CreateStruct", 221},
+			{"InitStructs", 522},
+			{"SetDefaultCallbacks", 32577},
+			{"SetupCallbacks", 33531},
+			{"SetupDamageFlags", 33542},
+			{"callbackVoid", 6662},
+			{"codescripts/character", 0xA4E5},
+			{"codescripts/delete", 0x053D},
+			{"codescripts/struct", 0x053E},
+			{"common_scripts/_artcommon", 42214},
+			{"common_scripts/_bcs_location_trigs", 42215},
+			{"common_scripts/_createfx", 42216},
+			{"common_scripts/_createfxmenu", 42217},
+			{"common_scripts/_destructible", 42218},
+			{"common_scripts/_dynamic_world", 42219},
+			{"main", 619},
+			{"maps/createart/mp_vlobby_room_art", 42735},
+			{"maps/createart/mp_vlobby_room_fog", 42736},
+			{"maps/createart/mp_vlobby_room_fog_hdr", 42737},
+			{"maps/mp/gametypes/_callbacksetup", 0x0540},
+			{"struct", 36698}
+		};
+
+		constexpr bool is_sorted_by_name(const name_table entries)
+		{
+			return std::adjacent_find(entries.begin(), entries.end(), [](const auto& a, const auto& b)
+			{
+				return a.first >= b.first;
+			}) == entries.end();
+		}
+
+		constexpr bool is_lowercase(const name_table entries)
+		{
+			return std::all_of(entries.begin(), entries.end(), [](const auto& entry)
+			{
+				return std::none_of(entry.first.begin(), entry.first.end(), [](const char c)
+				{
+					return c >= 'A' && c <= 'Z';
+				});
+			});
+		}
+
+		template <size_t Size>
+		constexpr auto sort_by_id(const std::pair<std::string_view, unsigned> (&entries)[Size])
+		{
+			std::array<std::pair<std::string_view, unsigned>, Size> sorted{};
+			std::copy(std::begin(entries), std::end(entries), sorted.begin());
+			std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b)
+			{
+				return a.second < b.second;
+			});
+
+			return sorted;
+		}
+
+		static_assert(is_sorted_by_name(function_entries));
+		static_assert(is_sorted_by_name(method_entries));
+		static_assert(is_sorted_by_name(token_entries));
+
+		static_assert(is_lowercase(function_entries));
+		static_assert(is_lowercase(method_entries));
+
+		constexpr auto token_entries_by_id = sort_by_id(token_entries);
+	}
+
+	const name_table function_map = function_entries;
+	const name_table method_map = method_entries;
+	const name_table token_map = token_entries;
+	const name_table token_map_by_id = token_entries_by_id;
 }
@@ -7,54 +7,37 @@ namespace scripting
 {
 	namespace
 	{
-		std::unordered_map<std::string, unsigned> lowercase_map(
-			const std::unordered_map<std::string, unsigned>& old_map)
+		std::optional<unsigned> find_name(const name_table table, const std::string_view name)
 		{
-			std::unordered_map<std::string, unsigned> new_map{};
-			for (auto& entry : old_map)
+			const auto entry = std::lower_bound(table.begin(), table.end(), name, [](const auto& a, const auto& b)
 			{
-				new_map[utils::string::to_lower(entry.first)] = entry.second;
+				return a.first < b;
+			});
+
+			if (entry == table.end() || entry->first != name)
+			{
+				return {};
 			}
 
-			return new_map;
+			return entry->second;
 		}
 
-		const std::unordered_map<std::string, unsigned>& get_methods()
+		int find_function_index(const std::string_view target, const bool prefer_global)
 		{
-			static auto methods = lowercase_map(method_map);
-			return methods;
-		}
-
-		const std::unordered_map<std::string, unsigned>& get_functions()
-		{
-			static auto function = lowercase_map(function_map);
-			return function;
-		}
-
-		int find_function_index(const std::string& name, const bool prefer_global)
-		{
-			const auto target = utils::string::to_lower(name);
-
-			const auto& primary_map = prefer_global
-				                          ? get_functions()
-				                          : get_methods();
-			const auto& secondary_map = !prefer_global
-				                            ? get_functions()
-				                            : get_methods();
-
-			auto function_entry = primary_map.find(target);
-			if (function_entry != primary_map.end())
-			{
-				return function_entry->second;
-			}
-
-			function_entry = secondary_map.find(target);
-			if (function_entry != secondary_map.end())
+			const auto primary_map = prefer_global
+				                         ? function_map
+				                         : method_map;
+			const auto secondary_map = !prefer_global
+				                           ? function_map
+				                           : method_map;
+
+			auto function_entry = find_name(primary_map, target);
+			if (!function_entry)
 			{
-				return function_entry->second;
+				function_entry = find_name(secondary_map, target);
 			}
 
-			return -1;
+			return function_entry ? static_cast<int>(*function_entry) : -1;
 		}
 
 		script_function get_function_by_index(const unsigned index)
@@ -73,12 +56,15 @@ namespace scripting
 
 	std::string find_token(unsigned int id)
 	{
-		for (const auto& token : token_map)
+		const auto token = std::lower_bound(token_map_by_id.begin(), token_map_by_id.end(), id,
+		                                    [](const auto& a, const unsigned b)
+		                                    {
+			                                    return a.second < b;
+		                                    });
+
+		if (token != token_map_by_id.end() && token->second == id)
 		{
-			if (token.second == id)
-			{
-				return token.first;
-			}
+			return std::string(token->first);
 		}
 
 		return utils::string::va("_ID%i", id);
@@ -86,21 +72,25 @@ namespace scripting
 
 	unsigned int find_token_id(const std::string& name)
 	{
-		const auto result = token_map.find(name);
-
-		if (result != token_map.end())
-		{
-			return result->second;
-		}
-
-		return 0;
+		return find_name(token_map, name).value_or(0);
 	}
 
 	script_function find_function(const std::string& name, const bool prefer_global)
 	{
-		const auto index = find_function_index(name, prefer_global);
+		const auto index = find_function_index(utils::string::to_lower(name), prefer_global);
 		if (index < 0) return nullptr;
 
 		return get_function_by_index(index);
 	}
+
+	function_handle find_function_handle(const std::string_view name)
+	{
+		const auto lookup = [&](const bool prefer_global) -> script_function
+		{
+			const auto index = find_function_index(name, prefer_global);
+			return index < 0 ? nullptr : get_function_by_index(index);
+		};
+
+		return {name, lookup(true), lookup(false)};
+	}
 }
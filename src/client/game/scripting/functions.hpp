@@ -3,9 +3,15 @@
 
 namespace scripting
 {
-	extern std::unordered_map<std::string, unsigned> method_map;
-	extern std::unordered_map<std::string, unsigned> function_map;
-	extern std::unordered_map<std::string, unsigned> token_map;
+	using name_table = std::span<const std::pair<std::string_view, unsigned>>;
+
+	// Sorted by name, function and method names are lowercase
+	extern const name_table method_map;
+	extern const name_table function_map;
+	extern const name_table token_map;
+
+	// token_map sorted by id
+	extern const name_table token_map_by_id;
 
 	using script_function = void(*)(game::scr_entref_t);
 
@@ -13,4 +19,14 @@ namespace scripting
 	unsigned int find_token_id(const std::string& name);
 
 	script_function find_function(const std::string& name, const bool prefer_global);
+
+	// Resolved once, for callers that know the name up front
+	struct function_handle
+	{
+		std::string_view name{};
+		script_function function = nullptr;
+		script_function method = nullptr;
+	};
+
+	function_handle find_function_handle(std::string_view name);
 }
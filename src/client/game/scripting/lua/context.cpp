@@ -87,6 +87,8 @@ namespace scripting::lua
 		{
 			state["level"] = entity{*game::levelEntityId};
 
+			setup_array_type(state);
+
 			auto vector_type = state.new_usertype<vector>("vector", sol::constructors<vector(float, float, float)>());
 			vector_type["x"] = sol::property(&vector::get_x, &vector::set_x);
 			vector_type["y"] = sol::property(&vector::get_y, &vector::set_y);
@@ -100,17 +102,14 @@ namespace scripting::lua
 
 			for (const auto& func : method_map)
 			{
-				const auto name = utils::string::to_lower(func.first);
-				entity_type[name.data()] = [name](const entity& entity, const sol::this_state s, sol::variadic_args va)
+				const auto function = find_function_handle(func.first);
+				entity_type[std::string(function.name)] = [function](const entity& entity, const sol::this_state s,
+				                                                    sol::variadic_args va)
 				{
-					std::vector<script_value> arguments{};
+					argument_buffer arguments{};
+					push_arguments(arguments, va);
 
-					for (auto arg : va)
-					{
-						arguments.push_back(convert({s, arg}));
-					}
-
-					return convert(s, entity.call(name, arguments));
+					return convert(s, call_function(function, entity, arguments));
 				};
 			}
 
@@ -178,14 +177,10 @@ namespace scripting::lua
 			entity_type["call"] = [](const entity& entity, const sol::this_state s, const std::string& function,
 			                         sol::variadic_args va)
 			{
-				std::vector<script_value> arguments{};
-
-				for (auto arg : va)
-				{
-					arguments.push_back(convert({s, arg}));
-				}
+				argument_buffer arguments{};
+				push_arguments(arguments, va);
 
-				return convert(s, entity.call(function, arguments));
+				return convert(s, call_function(function, entity, arguments));
 			};
 
 			entity_type[sol::meta_function::new_index] = [](const entity& entity, const std::string& field,
@@ -232,31 +227,24 @@ namespace scripting::lua
 
 			for (const auto& func : function_map)
 			{
-				const auto name = utils::string::to_lower(func.first);
-				game_type[name] = [name](const game&, const sol::this_state s, sol::variadic_args va)
+				const auto function = find_function_handle(func.first);
+				game_type[std::string(function.name)] = [function](const game&, const sol::this_state s,
+				                                                  sol::variadic_args va)
 				{
-					std::vector<script_value> arguments{};
+					argument_buffer arguments{};
+					push_arguments(arguments, va);
 
-					for (auto arg : va)
-					{
-						arguments.push_back(convert({s, arg}));
-					}
-
-					return convert(s, call(name, arguments));
+					return convert(s, call_function(function, entity(), arguments));
 				};
 			}
 
 			game_type["call"] = [](const game&, const sol::this_state s, const std::string& function,
 			                       sol::variadic_args va)
 			{
-				std::vector<script_value> arguments{};
+				argument_buffer arguments{};
+				push_arguments(arguments, va);
 
-				for (auto arg : va)
-				{
-					arguments.push_back(convert({s, arg}));
-				}
-
-				return convert(s, call(function, arguments));
+				return convert(s, call_function(function, entity(), arguments));
 			};
 
 			game_type["ontimeout"] = [&scheduler](const game&, const sol::protected_function& callback,
@@ -415,7 +403,8 @@ namespace scripting::lua
 	}
 
 	context::context(std::string folder)
-		: folder_(std::move(folder))
+		: state_(sol::default_at_panic, &profiler::allocate, &profiler_)
+		  , folder_(std::move(folder))
 		  , scheduler_(state_)
 		  , event_handler_(state_)
 
@@ -461,12 +450,18 @@ namespace scripting::lua
 
 	void context::run_frame()
 	{
-		this->scheduler_.run_frame();
-		this->collect_garbage();
+		{
+			profiler::timer _(this->profiler_, profiler::section::frame);
+			this->scheduler_.run_frame();
+			this->collect_garbage();
+		}
+
+		this->profiler_.end_frame();
 	}
 
 	void context::notify(const event& e)
 	{
+		profiler::timer _(this->profiler_, profiler::section::notify);
 		this->scheduler_.dispatch(e);
 		this->event_handler_.dispatch(e);
 	}
@@ -476,6 +471,26 @@ namespace scripting::lua
 		this->state_.collect_garbage();
 	}
 
+	void context::start_profiling(const int instruction_interval)
+	{
+		this->profiler_.start(this->state_.lua_state(), instruction_interval);
+	}
+
+	void context::stop_profiling()
+	{
+		this->profiler_.stop(this->state_.lua_state());
+	}
+
+	const std::string& context::get_folder() const
+	{
+		return this->folder_;
+	}
+
+	const profiler& context::get_profiler() const
+	{
+		return this->profiler_;
+	}
+
 	void context::load_script(const std::string& script)
 	{
 		if (!this->loaded_scripts_.emplace(script).second)
@@ -11,6 +11,7 @@
 
 #pragma warning(pop)
 
+#include "profiler.hpp"
 #include "scheduler.hpp"
 #include "event_handler.hpp"
 
@@ -32,8 +33,16 @@ namespace scripting::lua
 		void notify(const event& e);
 		void collect_garbage();
 
+		void start_profiling(int instruction_interval);
+		void stop_profiling();
+
+		const std::string& get_folder() const;
+		const profiler& get_profiler() const;
+
 	private:
-		sol::state state_{};
+		// Declared first, the state allocates through it until it is closed
+		profiler profiler_;
+		sol::state state_;
 		std::string folder_;
 		std::unordered_set<std::string> loaded_scripts_;
 
@@ -5,6 +5,7 @@
 #include "../execution.hpp"
 #include "../../../component/logfile.hpp"
 #include "../../../component/game_module.hpp"
+#include "../../../component/console.hpp"
 
 #include <utils/io.hpp>
 
@@ -18,6 +19,35 @@ namespace scripting::lua::engine
 			return scripts;
 		}
 
+		// Zero while not profiling
+		int profile_interval = 0;
+
+		// Only used from the server thread, which runs both notifies and scripts
+		struct notify_filter
+		{
+			std::unordered_set<std::string> names;
+			std::vector<game::scr_string_t> strings;
+			std::vector<uint64_t> bits;
+		};
+
+		notify_filter& get_notify_filter()
+		{
+			static notify_filter filter{};
+			return filter;
+		}
+
+		void clear_notify_filter()
+		{
+			auto& filter = get_notify_filter();
+
+			for (const auto string : filter.strings)
+			{
+				game::RemoveRefToValue(game::SCRIPT_STRING, {static_cast<int>(string)});
+			}
+
+			filter = {};
+		}
+
 		void load_scripts(const std::string& script_dir)
 		{
 			if (!utils::io::directory_exists(script_dir))
@@ -31,7 +61,11 @@ namespace scripting::lua::engine
 			{
 				if (std::filesystem::is_directory(script) && utils::io::file_exists(script + "/__init__.lua"))
 				{
-					get_scripts().push_back(std::make_unique<context>(script));
+					auto& loaded = get_scripts().emplace_back(std::make_unique<context>(script));
+					if (profile_interval)
+					{
+						loaded->start_profiling(profile_interval);
+					}
 				}
 			}
 		}
@@ -41,6 +75,7 @@ namespace scripting::lua::engine
 	{
 		logfile::clear_callbacks();
 		get_scripts().clear();
+		clear_notify_filter();
 	}
 
 	void start()
@@ -72,4 +107,85 @@ namespace scripting::lua::engine
 			script->run_frame();
 		}
 	}
+
+	void register_notify(const std::string& name)
+	{
+		auto& filter = get_notify_filter();
+		if (!filter.names.insert(name).second)
+		{
+			return;
+		}
+
+		// Keeps the reference, so the id stays valid until the filter is cleared
+		const auto string = game::SL_GetString(name.data(), 0);
+		filter.strings.push_back(string);
+
+		const auto index = static_cast<size_t>(string);
+		if (index / 64 >= filter.bits.size())
+		{
+			filter.bits.resize(index / 64 + 1);
+		}
+
+		filter.bits[index / 64] |= 1ull << (index % 64);
+	}
+
+	bool has_notify_listeners(const game::scr_string_t name)
+	{
+		const auto& bits = get_notify_filter().bits;
+		const auto index = static_cast<size_t>(name);
+
+		return index / 64 < bits.size() && (bits[index / 64] & (1ull << (index % 64)));
+	}
+
+	void start_profiling(const int instruction_interval)
+	{
+		profile_interval = std::max(instruction_interval, 1);
+
+		for (auto& script : get_scripts())
+		{
+			script->start_profiling(profile_interval);
+		}
+	}
+
+	void stop_profiling()
+	{
+		profile_interval = 0;
+
+		for (auto& script : get_scripts())
+		{
+			script->stop_profiling();
+		}
+	}
+
+	void print_profile(const std::string& filter)
+	{
+		for (const auto& script : get_scripts())
+		{
+			if (script->get_folder().find(filter) == std::string::npos)
+			{
+				continue;
+			}
+
+			console::info("%s\n", script->get_folder().data());
+			for (const auto& line : script->get_profiler().format_report(20))
+			{
+				console::info("  %s\n", line.data());
+			}
+		}
+	}
+
+	bool export_profile(const std::string& file)
+	{
+		std::string data;
+		for (const auto& script : get_scripts())
+		{
+			auto root = script->get_folder();
+			std::replace(root.begin(), root.end(), ';', ':');
+			std::replace(root.begin(), root.end(), ' ', '_');
+
+			script->get_profiler().write_folded_stacks(root, data);
+		}
+
+		return utils::io::write_file(file, data);
+	}
 }
@@ -8,4 +8,17 @@ namespace scripting::lua::engine
 	void stop();
 	void notify(const event& e);
 	void run_frame();
+
+	// Notifies that were never registered are not forwarded to scripts.
+	// Registrations last until the engine stops.
+	void register_notify(const std::string& name);
+	bool has_notify_listeners(game::scr_string_t name);
+
+	// Profiles every loaded script, and scripts loaded later, until stopped
+	void start_profiling(int instruction_interval);
+	void stop_profiling();
+
+	// Reports scripts whose folder contains the filter, all of them when it is empty
+	void print_profile(const std::string& filter);
+	bool export_profile(const std::string& file);
 }
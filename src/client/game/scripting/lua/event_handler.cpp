@@ -2,9 +2,45 @@
 #include "context.hpp"
 #include "error.hpp"
 #include "value_conversion.hpp"
+#include "engine.hpp"
 
 namespace scripting::lua
 {
+	namespace
+	{
+		uint64_t make_key(const entity& entity, const uint32_t event_id)
+		{
+			return (static_cast<uint64_t>(entity.get_entity_id()) << 32) | event_id;
+		}
+
+		uint32_t get_event_id(std::unordered_map<std::string, uint32_t>& event_ids, const std::string& event)
+		{
+			const auto [entry, inserted] = event_ids.try_emplace(event, static_cast<uint32_t>(event_ids.size()));
+			if (inserted)
+			{
+				engine::register_notify(event);
+			}
+
+			return entry->second;
+		}
+
+		void erase_from_key(std::unordered_map<uint64_t, std::vector<uint64_t>>& index, const uint64_t key,
+		                    const uint64_t id)
+		{
+			const auto entry = index.find(key);
+			if (entry == index.end())
+			{
+				return;
+			}
+
+			std::erase(entry->second, id);
+			if (entry->second.empty())
+			{
+				index.erase(entry);
+			}
+		}
+	}
+
 	event_handler::event_handler(sol::state& state)
 		: state_(state)
 	{
@@ -23,41 +59,51 @@ namespace scripting::lua
 
 	void event_handler::dispatch(const event& event)
 	{
-		bool has_built_arguments = false;
-		event_arguments arguments{};
-
-		callbacks_.access([&](task_list& tasks)
+		this->listeners_.access([&](listener_table& table)
 		{
-			this->merge_callbacks();
-			this->handle_endon_conditions(event);
+			// Events nobody ever listened or ended on don't have an id
+			const auto event_id = table.event_ids.find(event.name);
+			if (event_id == table.event_ids.end())
+			{
+				return;
+			}
+
+			const auto key = make_key(event.entity, event_id->second);
+			this->handle_endon_conditions(table, key);
+
+			const auto matching = table.listeners_by_key.find(key);
+			if (matching == table.listeners_by_key.end())
+			{
+				return;
+			}
+
+			// Callbacks may add or remove listeners, so work on a copy of the ids
+			const auto ids = matching->second;
+
+			bool has_built_arguments = false;
+			event_arguments arguments{};
 
-			for (auto i = tasks.begin(); i != tasks.end();)
+			for (const auto id : ids)
 			{
-				if (i->event != event.name || i->entity != event.entity)
+				const auto listener = table.listeners.find(id);
+				if (listener == table.listeners.end())
 				{
-					++i;
 					continue;
 				}
 
-				if (!i->is_deleted)
+				const auto callback = listener->second.callback;
+				if (listener->second.is_volatile)
 				{
-					if(!has_built_arguments)
-					{
-						has_built_arguments = true;
-						arguments = this->build_arguments(event);
-					}
-					
-					handle_error(i->callback(sol::as_args(arguments)));
+					unlink(table, id);
 				}
 
-				if (i->is_volatile || i->is_deleted)
+				if (!has_built_arguments)
 				{
-					i = tasks.erase(i);
-				}
-				else
-				{
-					++i;
+					has_built_arguments = true;
+					arguments = this->build_arguments(event);
 				}
+
+				handle_error(callback(sol::as_args(arguments)));
 			}
 		});
 	}
@@ -66,98 +112,84 @@ namespace scripting::lua
 	{
 		const uint64_t id = ++this->current_listener_id_;
 		listener.id = id;
-		listener.is_deleted = false;
+		listener.endon_conditions.clear();
 
-		new_callbacks_.access([&listener](task_list& tasks)
+		this->listeners_.access([&](listener_table& table)
 		{
-			tasks.emplace_back(std::move(listener));
+			listener.key = make_key(listener.entity, get_event_id(table.event_ids, listener.event));
+
+			table.listeners_by_key[listener.key].push_back(id);
+			table.listeners.emplace(id, std::move(listener));
 		});
 
 		return {id};
 	}
 
 	void event_handler::add_endon_condition(const event_listener_handle& handle, const entity& entity,
-			const std::string& event)
+	                                        const std::string& event)
 	{
-		auto merger = [&](task_list& tasks)
+		this->listeners_.access([&](listener_table& table)
 		{
-			for(auto& task : tasks)
+			const auto listener = table.listeners.find(handle.id);
+			if (listener == table.listeners.end())
 			{
-				if(task.id == handle.id)
-				{
-					task.endon_conditions.emplace_back(entity, event);
-				}
+				return;
 			}
-		};
-		
-		callbacks_.access([&](task_list& tasks)
-		{
-			merger(tasks);
-			new_callbacks_.access(merger);
+
+			const auto key = make_key(entity, get_event_id(table.event_ids, event));
+
+			listener->second.endon_conditions.push_back(key);
+			table.endons_by_key[key].push_back(handle.id);
 		});
 	}
 
 	void event_handler::clear()
 	{
-		callbacks_.access([&](task_list& tasks)
+		this->listeners_.access([](listener_table& table)
 		{
-			new_callbacks_.access([&](task_list& new_tasks)
-			{
-				new_tasks.clear();
-				tasks.clear();
-			});
+			table = {};
 		});
 	}
 
 	void event_handler::remove(const event_listener_handle& handle)
 	{
-		auto mask_as_deleted = [&](task_list& tasks)
+		this->listeners_.access([&](listener_table& table)
 		{
-			for (auto& task : tasks)
-			{
-				if (task.id == handle.id)
-				{
-					task.is_deleted = true;
-					break;
-				}
-			}
-		};
-
-		callbacks_.access(mask_as_deleted);
-		new_callbacks_.access(mask_as_deleted);
+			unlink(table, handle.id);
+		});
 	}
 
-	void event_handler::merge_callbacks()
+	void event_handler::unlink(listener_table& table, const uint64_t id)
 	{
-		callbacks_.access([&](task_list& tasks)
+		const auto listener = table.listeners.find(id);
+		if (listener == table.listeners.end())
 		{
-			new_callbacks_.access([&](task_list& new_tasks)
-			{
-				tasks.insert(tasks.end(), std::move_iterator(new_tasks.begin()),
-				             std::move_iterator(new_tasks.end()));
-				new_tasks = {};
-			});
-		});
+			return;
+		}
+
+		erase_from_key(table.listeners_by_key, listener->second.key, id);
+
+		for (const auto key : listener->second.endon_conditions)
+		{
+			erase_from_key(table.endons_by_key, key, id);
+		}
+
+		table.listeners.erase(listener);
 	}
 
-	void event_handler::handle_endon_conditions(const event& event)
+	void event_handler::handle_endon_conditions(listener_table& table, const uint64_t key)
 	{
-		auto deleter = [&](task_list& tasks)
+		const auto ended = table.endons_by_key.find(key);
+		if (ended == table.endons_by_key.end())
 		{
-			for(auto& task : tasks)
-			{
-				for(auto& condition : task.endon_conditions)
-				{
-					if(condition.first == event.entity && condition.second == event.name)
-					{
-						task.is_deleted = true;
-						break;
-					}
-				}
-			}
-		};
-		
-		callbacks_.access(deleter);
+			return;
+		}
+
+		const auto ids = ended->second;
+		for (const auto id : ids)
+		{
+			unlink(table, id);
+		}
 	}
 
 	event_arguments event_handler::build_arguments(const event& event) const
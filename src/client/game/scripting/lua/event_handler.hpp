@@ -18,8 +18,10 @@ namespace scripting::lua
 		entity entity{};
 		event_callback callback = {};
 		bool is_volatile = false;
-		bool is_deleted = false;
-		std::vector<std::pair<scripting::entity, std::string>> endon_conditions{};
+
+		// (entity, event) keys, filled in by the handler
+		uint64_t key = 0;
+		std::vector<uint64_t> endon_conditions{};
 	};
 
 	class event_handler final
@@ -40,16 +42,23 @@ namespace scripting::lua
 		void clear();
 
 	private:
+		struct listener_table
+		{
+			std::unordered_map<uint64_t, event_listener> listeners;
+			std::unordered_map<uint64_t, std::vector<uint64_t>> listeners_by_key;
+			std::unordered_map<uint64_t, std::vector<uint64_t>> endons_by_key;
+			std::unordered_map<std::string, uint32_t> event_ids;
+		};
+
 		sol::state& state_;
 		std::atomic_int64_t current_listener_id_ = 0;
 
-		using task_list = std::vector<event_listener>;
-		utils::concurrency::container<task_list> new_callbacks_;
-		utils::concurrency::container<task_list, std::recursive_mutex> callbacks_;
+		utils::concurrency::container<listener_table, std::recursive_mutex> listeners_;
 
 		void remove(const event_listener_handle& handle);
-		void merge_callbacks();
-		void handle_endon_conditions(const event& event);
+		void handle_endon_conditions(listener_table& table, uint64_t key);
+
+		static void unlink(listener_table& table, uint64_t id);
 
 		void add_endon_condition(const event_listener_handle& handle, const entity& entity, const std::string& event);
 
@@ -0,0 +1,327 @@
+#include <std_include.hpp>
+#include "context.hpp"
+
+#include <utils/string.hpp>
+
+namespace scripting::lua
+{
+	namespace
+	{
+		constexpr const char* section_names[] = {"frame", "notify"};
+
+		struct call_node
+		{
+			uint64_t samples = 0;
+			std::map<std::string, call_node> children;
+		};
+
+		double to_ms(const std::chrono::nanoseconds duration)
+		{
+			return std::chrono::duration<double, std::milli>(duration).count();
+		}
+
+		double percent(const uint64_t part, const uint64_t total)
+		{
+			return total ? 100.0 * static_cast<double>(part) / static_cast<double>(total) : 0.0;
+		}
+
+		std::vector<std::string_view> split_stack(const std::string_view stack)
+		{
+			std::vector<std::string_view> frames;
+
+			size_t start = 0;
+			while (start <= stack.size())
+			{
+				const auto end = std::min(stack.find(';', start), stack.size());
+				frames.push_back(stack.substr(start, end - start));
+				start = end + 1;
+			}
+
+			return frames;
+		}
+
+		// Identifies the function rather than the current line, so samples inside one function add up
+		std::string get_frame_name(const lua_Debug& info)
+		{
+			std::string name = info.name ? info.name : "?";
+
+			if (info.what && info.what == std::string_view("C"))
+			{
+				name += " [C]";
+			}
+			else if (info.what && info.what == std::string_view("main"))
+			{
+				name = std::string("main ") + info.short_src;
+			}
+			else
+			{
+				name += " " + std::string(info.short_src) + ":" + std::to_string(info.linedefined);
+			}
+
+			std::replace(name.begin(), name.end(), ';', ':');
+			return name;
+		}
+
+		void format_tree(const call_node& node, const std::string& name, const uint64_t total, const size_t depth,
+		                 const size_t max_entries, std::vector<std::string>& lines)
+		{
+			if (lines.size() >= max_entries)
+			{
+				return;
+			}
+
+			lines.push_back(utils::string::va("%*s%5.1f%% %s", static_cast<int>(depth * 2), "",
+			                                  percent(node.samples, total), name.data()));
+
+			std::vector<std::pair<const std::string*, const call_node*>> children;
+			for (const auto& [child_name, child] : node.children)
+			{
+				children.emplace_back(&child_name, &child);
+			}
+
+			std::stable_sort(children.begin(), children.end(), [](const auto& a, const auto& b)
+			{
+				return a.second->samples > b.second->samples;
+			});
+
+			for (const auto& [child_name, child] : children)
+			{
+				format_tree(*child, *child_name, total, depth + 1, max_entries, lines);
+			}
+		}
+	}
+
+	profiler::timer::timer(profiler& profiler, const section section)
+		: profiler_(profiler), section_(section)
+	{
+		if (this->profiler_.running_)
+		{
+			this->start_ = std::chrono::steady_clock::now();
+		}
+	}
+
+	profiler::timer::~timer()
+	{
+		if (!this->profiler_.running_ || this->start_ == std::chrono::steady_clock::time_point{})
+		{
+			return;
+		}
+
+		const auto duration = std::chrono::steady_clock::now() - this->start_;
+		this->profiler_.sections_[static_cast<size_t>(this->section_)].add(duration);
+		this->profiler_.current_frame_ += duration;
+	}
+
+	void profiler::time_stats::add(const std::chrono::nanoseconds duration)
+	{
+		++this->count;
+		this->total += duration;
+		this->max = std::max(this->max, duration);
+	}
+
+	void* profiler::allocate(void* userdata, void* pointer, const size_t old_size, const size_t new_size)
+	{
+		auto& memory = static_cast<profiler*>(userdata)->memory_;
+
+		// Without a block, old_size holds the type of the new object
+		const auto previous_size = pointer ? old_size : 0;
+
+		if (new_size == 0)
+		{
+			free(pointer);
+			memory.current -= previous_size;
+			return nullptr;
+		}
+
+		auto* result = realloc(pointer, new_size);
+		if (!result)
+		{
+			return nullptr;
+		}
+
+		if (!pointer)
+		{
+			++memory.allocations;
+		}
+
+		memory.current = memory.current - previous_size + new_size;
+		memory.peak = std::max(memory.peak, memory.current);
+		return result;
+	}
+
+	void profiler::start(lua_State* state, const int instruction_interval)
+	{
+		this->running_ = true;
+		this->interval_ = std::max(instruction_interval, 1);
+
+		this->sections_ = {};
+		this->frames_ = {};
+		this->current_frame_ = {};
+		this->samples_ = 0;
+		this->stacks_.clear();
+		this->memory_.peak = this->memory_.current;
+		this->memory_.allocations = 0;
+
+		// Coroutines created from now on inherit the hook
+		lua_sethook(state, &profiler::hook, LUA_MASKCOUNT, this->interval_);
+	}
+
+	void profiler::stop(lua_State* state)
+	{
+		this->running_ = false;
+		lua_sethook(state, nullptr, 0, 0);
+	}
+
+	bool profiler::is_running() const
+	{
+		return this->running_;
+	}
+
+	void profiler::end_frame()
+	{
+		if (this->running_)
+		{
+			this->frames_.add(this->current_frame_);
+			this->current_frame_ = {};
+		}
+	}
+
+	void profiler::hook(lua_State* state, lua_Debug* /*debug*/)
+	{
+		void* userdata{};
+		lua_getallocf(state, &userdata);
+		static_cast<profiler*>(userdata)->sample(state);
+	}
+
+	void profiler::sample(lua_State* state)
+	{
+		if (!this->running_)
+		{
+			return;
+		}
+
+		std::vector<std::string> frames;
+
+		lua_Debug info{};
+		for (auto level = 0; lua_getstack(state, level, &info); ++level)
+		{
+			if (!lua_getinfo(state, "Sn", &info))
+			{
+				break;
+			}
+
+			frames.push_back(get_frame_name(info));
+		}
+
+		if (frames.empty())
+		{
+			return;
+		}
+
+		std::string stack;
+		for (auto frame = frames.rbegin(); frame != frames.rend(); ++frame)
+		{
+			if (!stack.empty())
+			{
+				stack += ';';
+			}
+
+			stack += *frame;
+		}
+
+		++this->samples_;
+		++this->stacks_[stack];
+	}
+
+	std::vector<std::string> profiler::format_report(const size_t max_entries) const
+	{
+		std::vector<std::string> lines;
+
+		lines.push_back(utils::string::va("memory: %.1f KiB current, %.1f KiB peak, %llu allocations",
+		                                  this->memory_.current / 1024.0, this->memory_.peak / 1024.0,
+		                                  this->memory_.allocations));
+
+		lines.push_back(utils::string::va("server frames: %llu, %.3f ms avg, %.3f ms max, %.3f ms total",
+		                                  this->frames_.count,
+		                                  this->frames_.count ? to_ms(this->frames_.total) / this->frames_.count : 0.0,
+		                                  to_ms(this->frames_.max), to_ms(this->frames_.total)));
+
+		for (size_t i = 0; i < this->sections_.size(); ++i)
+		{
+			const auto& section = this->sections_[i];
+			lines.push_back(utils::string::va("  %-8s %8llu calls, %.3f ms avg, %.3f ms max", section_names[i],
+			                                  section.count,
+			                                  section.count ? to_ms(section.total) / section.count : 0.0,
+			                                  to_ms(section.max)));
+		}
+
+		lines.push_back(utils::string::va("samples: %llu, one every %d instructions", this->samples_, this->interval_));
+		if (!this->samples_)
+		{
+			return lines;
+		}
+
+		std::unordered_map<std::string_view, std::pair<uint64_t, uint64_t>> functions;
+		call_node root{};
+
+		for (const auto& [stack, count] : this->stacks_)
+		{
+			const auto frames = split_stack(stack);
+
+			std::unordered_set<std::string_view> seen;
+			auto* node = &root;
+			node->samples += count;
+
+			for (const auto& frame : frames)
+			{
+				if (seen.insert(frame).second)
+				{
+					functions[frame].second += count;
+				}
+
+				node = &node->children[std::string(frame)];
+				node->samples += count;
+			}
+
+			functions[frames.back()].first += count;
+		}
+
+		std::vector<std::pair<std::string_view, std::pair<uint64_t, uint64_t>>> flat(functions.begin(), functions.end());
+		std::sort(flat.begin(), flat.end(), [](const auto& a, const auto& b)
+		{
+			return a.second.first != b.second.first ? a.second.first > b.second.first : a.second.second > b.second.second;
+		});
+
+		lines.emplace_back("flat profile:");
+		lines.emplace_back("    self   total  function");
+
+		for (size_t i = 0; i < flat.size() && i < max_entries; ++i)
+		{
+			const auto& [name, counts] = flat[i];
+			lines.push_back(utils::string::va("  %5.1f%% %5.1f%%  %.*s", percent(counts.first, this->samples_),
+			                                  percent(counts.second, this->samples_), static_cast<int>(name.size()),
+			                                  name.data()));
+		}
+
+		lines.emplace_back("call tree:");
+
+		std::vector<std::string> tree;
+		format_tree(root, "all", this->samples_, 1, max_entries + 1, tree);
+		lines.insert(lines.end(), tree.begin(), tree.end());
+
+		return lines;
+	}
+
+	void profiler::write_folded_stacks(const std::string& root, std::string& output) const
+	{
+		for (const auto& [stack, count] : this->stacks_)
+		{
+			output += root;
+			output += ';';
+			output += stack;
+			output += ' ';
+			output += std::to_string(count);
+			output += '\n';
+		}
+	}
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+namespace scripting::lua
+{
+	// Per script profile: memory through the state's allocator, wall time per
+	// server frame, and Lua stacks sampled every N instructions.
+	// Only used from the server thread.
+	class profiler final
+	{
+	public:
+		enum class section
+		{
+			frame,
+			notify,
+			count,
+		};
+
+		class timer final
+		{
+		public:
+			timer(profiler& profiler, section section);
+			~timer();
+
+			timer(timer&&) = delete;
+			timer(const timer&) = delete;
+			timer& operator=(timer&&) = delete;
+			timer& operator=(const timer&) = delete;
+
+		private:
+			profiler& profiler_;
+			section section_;
+			std::chrono::steady_clock::time_point start_{};
+		};
+
+		profiler() = default;
+
+		profiler(profiler&&) = delete;
+		profiler(const profiler&) = delete;
+		profiler& operator=(profiler&&) = delete;
+		profiler& operator=(const profiler&) = delete;
+
+		// lua_Alloc, the profiler is the userdata
+		static void* allocate(void* userdata, void* pointer, size_t old_size, size_t new_size);
+
+		void start(lua_State* state, int instruction_interval);
+		void stop(lua_State* state);
+		bool is_running() const;
+
+		// Closes the server frame, everything timed since the last call belongs to it
+		void end_frame();
+
+		std::vector<std::string> format_report(size_t max_entries) const;
+
+		// One "frame;frame;frame count" line per sampled stack, the format flame graph tools read
+		void write_folded_stacks(const std::string& root, std::string& output) const;
+
+	private:
+		struct memory_stats
+		{
+			size_t current = 0;
+			size_t peak = 0;
+			uint64_t allocations = 0;
+		};
+
+		struct time_stats
+		{
+			uint64_t count = 0;
+			std::chrono::nanoseconds total{};
+			std::chrono::nanoseconds max{};
+
+			void add(std::chrono::nanoseconds duration);
+		};
+
+		memory_stats memory_{};
+
+		bool running_ = false;
+		int interval_ = 0;
+
+		std::array<time_stats, static_cast<size_t>(section::count)> sections_{};
+		time_stats frames_{};
+		std::chrono::nanoseconds current_frame_{};
+
+		uint64_t samples_ = 0;
+		std::unordered_map<std::string, uint64_t> stacks_{};
+
+		static void hook(lua_State* state, lua_Debug* debug);
+		void sample(lua_State* state);
+	};
+}
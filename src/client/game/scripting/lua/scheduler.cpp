@@ -1,9 +1,18 @@
 #include "std_include.hpp"
 #include "context.hpp"
 #include "error.hpp"
+#include "engine.hpp"
 
 namespace scripting::lua
 {
+	namespace
+	{
+		uint64_t make_key(const entity& entity, const uint32_t event_id)
+		{
+			return (static_cast<uint64_t>(entity.get_entity_id()) << 32) | event_id;
+		}
+	}
+
 	scheduler::scheduler(sol::state& state)
 	{
 		auto task_handle_type = state.new_usertype<task_handle>("task_handle");
@@ -21,73 +30,100 @@ namespace scripting::lua
 
 	void scheduler::dispatch(const event& event)
 	{
-		auto deleter = [&](task_list& tasks)
+		this->tasks_.access([&](task_table& table)
 		{
-			for(auto& task : tasks)
+			const auto event_id = table.event_ids.find(event.name);
+			if (event_id == table.event_ids.end())
 			{
-				for(auto& condition : task.endon_conditions)
-				{
-					if(condition.first == event.entity && condition.second == event.name)
-					{
-						task.is_deleted = true;
-						break;
-					}
-				}
+				return;
+			}
+
+			const auto ended = table.endons_by_key.find(make_key(event.entity, event_id->second));
+			if (ended == table.endons_by_key.end())
+			{
+				return;
+			}
+
+			const auto ids = ended->second;
+			for (const auto id : ids)
+			{
+				unlink(table, id);
 			}
-		};
-		
-		callbacks_.access([&](task_list& tasks)
-		{
-			deleter(tasks);
-			new_callbacks_.access(deleter);
 		});
 	}
 
 	void scheduler::run_frame()
 	{
-		callbacks_.access([&](task_list& tasks)
+		this->tasks_.access([&](task_table& table)
 		{
-			this->merge_callbacks();
-
-			for (auto i = tasks.begin(); i != tasks.end();)
+			const auto now = this->get_tick(std::chrono::steady_clock::now());
+			if (now <= table.current_tick)
 			{
-				const auto now = std::chrono::high_resolution_clock::now();
-				const auto diff = now - i->last_call;
+				return;
+			}
+
+			// Each bucket is visited once, even if more than a full turn has passed
+			const auto buckets = std::min<uint64_t>(now - table.current_tick, wheel_size);
 
-				if (diff < i->delay)
+			std::vector<timer> due{};
+			for (uint64_t tick = now - buckets + 1; tick <= now; ++tick)
+			{
+				auto& bucket = table.wheel[tick % wheel_size];
+				for (size_t i = 0; i < bucket.size();)
 				{
-					++i;
-					continue;
+					if (bucket[i].due > now)
+					{
+						++i;
+						continue;
+					}
+
+					due.push_back(bucket[i]);
+					bucket[i] = bucket.back();
+					bucket.pop_back();
 				}
+			}
 
-				i->last_call = now;
+			// Tasks added or rescheduled from here on are due next frame at the earliest
+			table.current_tick = now;
 
-				if (!i->is_deleted)
+			// Run in the order the tasks were added
+			std::sort(due.begin(), due.end(), [](const timer& a, const timer& b)
+			{
+				return a.id < b.id;
+			});
+
+			for (const auto& timer : due)
+			{
+				const auto entry = table.tasks.find(timer.id);
+				if (entry == table.tasks.end())
 				{
-					handle_error(i->callback());
+					continue;
 				}
 
-				if (i->is_volatile || i->is_deleted)
+				const auto callback = entry->second.callback;
+
+				if (entry->second.is_volatile)
 				{
-					i = tasks.erase(i);
+					unlink(table, timer.id);
 				}
 				else
 				{
-					++i;
+					schedule(table, timer.id, now + entry->second.delay.count());
 				}
+
+				handle_error(callback());
 			}
 		});
 	}
 
 	void scheduler::clear()
 	{
-		callbacks_.access([&](task_list& tasks)
+		this->tasks_.access([](task_table& table)
 		{
-			new_callbacks_.access([&](task_list& new_tasks)
-			{
-				new_tasks.clear();
-				tasks.clear();
-			});
+			const auto current_tick = table.current_tick;
+
+			table = {};
+			table.current_tick = current_tick;
 		});
 	}
 
@@ -106,66 +142,88 @@ namespace scripting::lua
 		task.is_volatile = is_volatile;
 		task.callback = callback;
 		task.delay = delay;
-		task.last_call = std::chrono::steady_clock::now();
 		task.id = id;
-		task.is_deleted = false;
 
-		new_callbacks_.access([&task](task_list& tasks)
+		const auto due = this->get_tick(std::chrono::steady_clock::now()) + std::max<int64_t>(delay.count(), 0);
+
+		this->tasks_.access([&](task_table& table)
 		{
-			tasks.emplace_back(std::move(task));
+			table.tasks.emplace(id, std::move(task));
+			schedule(table, id, due);
 		});
 
 		return {id};
 	}
 
+	uint64_t scheduler::get_tick(const std::chrono::steady_clock::time_point time) const
+	{
+		return static_cast<uint64_t>(
+			std::chrono::duration_cast<std::chrono::milliseconds>(time - this->start_).count());
+	}
+
 	void scheduler::add_endon_condition(const task_handle& handle, const entity& entity, const std::string& event)
 	{
-		auto merger = [&](task_list& tasks)
+		this->tasks_.access([&](task_table& table)
 		{
-			for(auto& task : tasks)
+			const auto task = table.tasks.find(handle.id);
+			if (task == table.tasks.end())
 			{
-				if(task.id == handle.id)
-				{
-					task.endon_conditions.emplace_back(entity, event);
-				}
+				return;
 			}
-		};
-		
-		callbacks_.access([&](task_list& tasks)
-		{
-			merger(tasks);
-			new_callbacks_.access(merger);
+
+			const auto [event_id, inserted] = table.event_ids.try_emplace(
+				event, static_cast<uint32_t>(table.event_ids.size()));
+			if (inserted)
+			{
+				engine::register_notify(event);
+			}
+
+			const auto key = make_key(entity, event_id->second);
+
+			task->second.endon_conditions.push_back(key);
+			table.endons_by_key[key].push_back(handle.id);
 		});
 	}
 
 	void scheduler::remove(const task_handle& handle)
 	{
-		auto mask_as_deleted = [&](task_list& tasks)
+		this->tasks_.access([&](task_table& table)
 		{
-			for (auto& task : tasks)
-			{
-				if (task.id == handle.id)
-				{
-					task.is_deleted = true;
-					break;
-				}
-			}
-		};
+			unlink(table, handle.id);
+		});
+	}
 
-		callbacks_.access(mask_as_deleted);
-		new_callbacks_.access(mask_as_deleted);
+	void scheduler::schedule(task_table& table, const uint64_t id, const uint64_t due)
+	{
+		// Buckets up to the current tick have already been visited
+		const auto tick = std::max(due, table.current_tick + 1);
+		table.wheel[tick % wheel_size].push_back({tick, id});
 	}
 
-	void scheduler::merge_callbacks()
+	void scheduler::unlink(task_table& table, const uint64_t id)
 	{
-		callbacks_.access([&](task_list& tasks)
+		const auto task = table.tasks.find(id);
+		if (task == table.tasks.end())
+		{
+			return;
+		}
+
+		// The timer stays in its bucket and is dropped once it comes due
+		for (const auto key : task->second.endon_conditions)
 		{
-			new_callbacks_.access([&](task_list& new_tasks)
+			const auto entry = table.endons_by_key.find(key);
+			if (entry == table.endons_by_key.end())
 			{
-				tasks.insert(tasks.end(), std::move_iterator<task_list::iterator>(new_tasks.begin()),
-				             std::move_iterator<task_list::iterator>(new_tasks.end()));
-				new_tasks = {};
-			});
-		});
+				continue;
+			}
+
+			std::erase(entry->second, id);
+			if (entry->second.empty())
+			{
+				table.endons_by_key.erase(entry);
+			}
+		}
+
+		table.tasks.erase(task);
 	}
 }
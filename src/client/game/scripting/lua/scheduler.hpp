@@ -14,12 +14,12 @@ namespace scripting::lua
 	class task final : public task_handle
 	{
 	public:
-		std::chrono::steady_clock::time_point last_call{};
 		sol::protected_function callback{};
 		std::chrono::milliseconds delay{};
 		bool is_volatile = false;
-		bool is_deleted = false;
-		std::vector<std::pair<entity, std::string>> endon_conditions{};
+
+		// (entity, event) keys
+		std::vector<uint64_t> endon_conditions{};
 	};
 
 	class scheduler final
@@ -41,14 +41,36 @@ namespace scripting::lua
 		task_handle add(const sol::protected_function& callback, std::chrono::milliseconds delay, bool is_volatile);
 
 	private:
-		using task_list = std::vector<task>;
-		utils::concurrency::container<task_list> new_callbacks_;
-		utils::concurrency::container<task_list, std::recursive_mutex> callbacks_;
+		// One bucket per millisecond, tasks due further out wait for later turns
+		static constexpr size_t wheel_size = 1024;
+
+		struct timer
+		{
+			uint64_t due;
+			uint64_t id;
+		};
+
+		struct task_table
+		{
+			std::unordered_map<uint64_t, task> tasks;
+			std::unordered_map<uint64_t, std::vector<uint64_t>> endons_by_key;
+			std::unordered_map<std::string, uint32_t> event_ids;
+
+			std::array<std::vector<timer>, wheel_size> wheel;
+			uint64_t current_tick = 0;
+		};
+
+		utils::concurrency::container<task_table, std::recursive_mutex> tasks_;
 		std::atomic_int64_t current_task_id_ = 0;
+		std::chrono::steady_clock::time_point start_ = std::chrono::steady_clock::now();
+
+		uint64_t get_tick(std::chrono::steady_clock::time_point time) const;
 
 		void add_endon_condition(const task_handle& handle, const entity& entity, const std::string& event);
-		
+
 		void remove(const task_handle& handle);
-		void merge_callbacks();
+
+		static void schedule(task_table& table, uint64_t id, uint64_t due);
+		static void unlink(task_table& table, uint64_t id);
 	};
 }
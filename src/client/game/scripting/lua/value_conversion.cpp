@@ -8,113 +8,197 @@ namespace scripting::lua
 {
 	namespace
 	{
-		struct array_value
+		// A GSC array seen from Lua. Keys are resolved on access, only the
+		// positions of numbered elements are remembered once walked past.
+		struct array_view
 		{
-			int index;
-			script_value value;
+			entity object{};
+
+			std::vector<unsigned int> positions{};
+			unsigned int next_child = 0;
+			size_t walked = 0;
+			bool started = false;
+
+			// The array as the walk started on it, the walk starts over once it differs
+			unsigned int first_child = 0;
+			unsigned int last_child = 0;
+			unsigned int size = 0;
 		};
 
-		sol::lua_value entity_to_array(lua_State* state, unsigned int id)
+		unsigned int get_child_offset(const unsigned int id)
 		{
-			auto table = sol::table::create(state);
-			auto metatable = sol::table::create(state);
+			return 64000 * (id & 3);
+		}
 
-			std::unordered_map<std::string, array_value> values;
+		const char* get_string_key(const game::ChildVariableValue& variable)
+		{
+			const auto string_value = (game::scr_string_t)((unsigned __int8)variable.name_lo
+				+ (variable.k.keys.name_hi << 8));
+			return string_value < 0x40000 ? game::SL_ConvertToString(string_value) : nullptr;
+		}
 
-			const auto offset = 64000 * (id & 3);
+		script_value get_child_value(const unsigned int index)
+		{
+			const auto& variable = game::scr_VarGlob->childVariableValue[index];
 
-			auto current = game::scr_VarGlob->objectVariableChildren[id].firstChild;
-			auto idx = 1;
+			game::VariableValue value{};
+			value.type = (game::scriptType_e)variable.type;
+			value.u = variable.u.u;
 
-			for (auto i = offset + current; current; i = offset + current)
-			{
-				const auto var = game::scr_VarGlob->childVariableValue[i];
+			return value;
+		}
 
-				if (var.type == game::SCRIPT_NONE)
-				{
-					current = var.nextSibling;
-					continue;
-				}
+		// The slot still holds a live element of the array, it may have been freed and reused since it was cached
+		bool is_child_of(const unsigned int id, const unsigned int index)
+		{
+			const auto& variable = game::scr_VarGlob->childVariableValue[index];
+			return variable.type != game::SCRIPT_NONE && variable.k.keys.parentId == id;
+		}
 
-				const auto string_value = (game::scr_string_t)((unsigned __int8)var.name_lo + (var.k.keys.name_hi << 8));
-				const auto* str = game::SL_ConvertToString(string_value);
+		void restart_walk(array_view& view)
+		{
+			view.positions.clear();
+			view.next_child = 0;
+			view.walked = 0;
+			view.started = false;
+		}
 
-				std::string key = string_value < 0x40000 && str
-					? str
-					: std::to_string(idx++);
+		// Drops what was walked so far if elements were added or removed since
+		void restart_walk_if_changed(array_view& view)
+		{
+			const auto id = view.object.get_entity_id();
+			const auto& children = game::scr_VarGlob->objectVariableChildren[id];
 
-				game::VariableValue variable{};
-				variable.type = var.type;
-				variable.u = var.u.u;
+			if (view.started && (children.firstChild != view.first_child || children.lastChild != view.last_child
+				|| game::scr_VarGlob->objectVariableValue[id].u.o.u.size != view.size))
+			{
+				restart_walk(view);
+			}
+		}
 
-				array_value value;
-				value.index = i;
-				value.value = variable;
+		// Steps over one more child, false once the whole array was walked
+		bool walk(array_view& view)
+		{
+			const auto id = view.object.get_entity_id();
+			restart_walk_if_changed(view);
 
-				values[key] = value;
+			if (!view.started)
+			{
+				const auto& children = game::scr_VarGlob->objectVariableChildren[id];
 
-				current = var.nextSibling;
+				view.started = true;
+				view.next_child = children.firstChild;
+				view.first_child = children.firstChild;
+				view.last_child = children.lastChild;
+				view.size = game::scr_VarGlob->objectVariableValue[id].u.o.u.size;
 			}
 
-			table["getkeys"] = [values]()
+			if (!view.next_child)
 			{
-				std::vector<std::string> _keys;
+				return false;
+			}
 
-				for (const auto& entry : values)
+			const auto index = get_child_offset(id) + view.next_child;
+			const auto& variable = game::scr_VarGlob->childVariableValue[index];
+			view.next_child = variable.nextSibling;
+
+			if (is_child_of(id, index))
+			{
+				++view.walked;
+				if (!get_string_key(variable))
 				{
-					_keys.push_back(entry.first);
+					view.positions.push_back(index);
 				}
+			}
 
-				return _keys;
-			};
+			return true;
+		}
 
-			metatable[sol::meta_function::new_index] = [values](const sol::table t, const sol::this_state s,
-				const sol::lua_value& key_value, const sol::lua_value& value)
+		std::optional<unsigned int> find_child(array_view& view, const sol::lua_value& key)
+		{
+			if (key.is<int>())
 			{
-				const auto key = key_value.is<int>()
-					? std::to_string(key_value.as<int>())
-					: key_value.as<std::string>();
+				const auto position = key.as<int>();
+				if (position < 1)
+				{
+					return {};
+				}
+
+				restart_walk_if_changed(view);
+
+				while (view.positions.size() < static_cast<size_t>(position) && walk(view))
+				{
+				}
 
-				if (values.find(key) == values.end())
+				if (view.positions.size() < static_cast<size_t>(position))
 				{
-					return;
+					return {};
 				}
 
-				const auto i = values.at(key).index;
-				const auto variable = &game::scr_VarGlob->childVariableValue[i];
+				// Elements can be replaced without changing the array's ends or size, a write
+				// through a slot that is no longer part of it would corrupt the VM
+				const auto index = view.positions[position - 1];
+				if (!is_child_of(view.object.get_entity_id(), index))
+				{
+					restart_walk(view);
+					return find_child(view, key);
+				}
 
-				const auto new_variable = convert({s, value}).get_raw();
+				return index;
+			}
 
-				game::AddRefToValue(new_variable.type, new_variable.u);
-				game::RemoveRefToValue(variable->type, variable->u.u);
+			if (!key.is<std::string>())
+			{
+				return {};
+			}
 
-				variable->type = (char)new_variable.type;
-				variable->u.u = new_variable.u;
-			};
+			const auto name = game::SL_FindString(key.as<std::string>().data());
+			if (!name)
+			{
+				return {};
+			}
 
-			metatable[sol::meta_function::index] = [values](const sol::table t, const sol::this_state s,
-				const sol::lua_value& key_value)
+			const auto id = view.object.get_entity_id();
+			const auto variable_id = game::FindVariable(id, name);
+			if (!variable_id)
 			{
-				const auto key = key_value.is<int>()
-					? std::to_string(key_value.as<int>())
-					: key_value.as<std::string>();
+				return {};
+			}
 
-				if (values.find(key) == values.end())
-				{
-					return sol::lua_value{s, sol::lua_nil};
-				}
+			return get_child_offset(id) + variable_id;
+		}
 
-				return convert(s, values.at(key).value);
-			};
+		sol::lua_value entity_to_array(lua_State* state, unsigned int id)
+		{
+			array_view view{};
+			view.object = entity(id);
+
+			return {state, std::move(view)};
+		}
 
-			metatable[sol::meta_function::length] = [values]()
+		std::vector<std::string> get_array_keys(const entity& object)
+		{
+			std::vector<std::string> keys;
+
+			const auto id = object.get_entity_id();
+			const auto offset = get_child_offset(id);
+
+			auto position = 1;
+			for (auto current = game::scr_VarGlob->objectVariableChildren[id].firstChild; current;)
 			{
-				return values.size();
-			};
+				const auto& variable = game::scr_VarGlob->childVariableValue[offset + current];
+				current = variable.nextSibling;
 
-			table[sol::metatable_key] = metatable;
+				if (variable.type == game::SCRIPT_NONE)
+				{
+					continue;
+				}
+
+				const auto* str = get_string_key(variable);
+				keys.emplace_back(str ? str : std::to_string(position++));
+			}
 
-			return {state, table};
+			return keys;
 		}
 
 		game::VariableValue convert_function(sol::lua_value value)
@@ -160,6 +244,110 @@ namespace scripting::lua
 		}
 	}
 
+	void setup_array_type(sol::state& state)
+	{
+		auto array_type = state.new_usertype<array_view>("array_view", sol::no_constructor);
+
+		array_type[sol::meta_function::index] = [](array_view& view, const sol::this_state s,
+		                                           const sol::lua_value& key) -> sol::lua_value
+		{
+			if (key.is<std::string>() && key.as<std::string>() == "getkeys")
+			{
+				return {s, [object = view.object]()
+				{
+					return get_array_keys(object);
+				}};
+			}
+
+			const auto index = find_child(view, key);
+			if (!index)
+			{
+				return {s, sol::lua_nil};
+			}
+
+			return convert(s, get_child_value(*index));
+		};
+
+		array_type[sol::meta_function::new_index] = [](array_view& view, const sol::this_state s,
+		                                               const sol::lua_value& key, const sol::lua_value& value)
+		{
+			const auto index = find_child(view, key);
+			if (!index)
+			{
+				return;
+			}
+
+			const auto variable = &game::scr_VarGlob->childVariableValue[*index];
+			const auto new_variable = convert({s, value}).get_raw();
+
+			game::AddRefToValue(new_variable.type, new_variable.u);
+			game::RemoveRefToValue(variable->type, variable->u.u);
+
+			variable->type = (char)new_variable.type;
+			variable->u.u = new_variable.u;
+		};
+
+		array_type[sol::meta_function::length] = [](array_view& view)
+		{
+			while (walk(view))
+			{
+			}
+
+			return view.walked;
+		};
+
+		// Walks the children as it goes, numbered elements get their position as key
+		array_type[sol::meta_function::pairs] = [](const array_view& view, const sol::this_state s)
+		{
+			const auto id = view.object.get_entity_id();
+
+			struct cursor
+			{
+				entity object;
+				unsigned int current;
+				int position;
+			};
+
+			const auto first_child = game::scr_VarGlob->objectVariableChildren[id].firstChild;
+			auto state = std::make_shared<cursor>(cursor{view.object, first_child, 0});
+
+			const auto next = [state](const sol::this_state s) -> std::tuple<sol::lua_value, sol::lua_value>
+			{
+				const auto id = state->object.get_entity_id();
+				const auto offset = get_child_offset(id);
+
+				while (state->current)
+				{
+					const auto index = offset + state->current;
+					const auto& variable = game::scr_VarGlob->childVariableValue[index];
+
+					// The element was removed while iterating, its siblings can't be trusted anymore
+					if (variable.k.keys.parentId != id)
+					{
+						break;
+					}
+
+					state->current = variable.nextSibling;
+
+					if (variable.type == game::SCRIPT_NONE)
+					{
+						continue;
+					}
+
+					const auto* str = get_string_key(variable);
+					auto key = str ? sol::lua_value{s, str} : sol::lua_value{s, ++state->position};
+
+					return {std::move(key), convert(s, get_child_value(index))};
+				}
+
+				return {sol::lua_value{s, sol::lua_nil}, sol::lua_value{s, sol::lua_nil}};
+			};
+
+			return std::make_tuple(sol::lua_value{s, next}, sol::lua_value{s, sol::lua_nil},
+			                       sol::lua_value{s, sol::lua_nil});
+		};
+	}
+
 	sol::lua_value entity_to_struct(lua_State* state, unsigned int parent_id)
 	{
 		auto table = sol::table::create(state);
@@ -264,6 +452,11 @@ namespace scripting::lua
 			return {value.as<vector>()};
 		}
 
+		if (value.is<array_view>())
+		{
+			return {value.as<array_view>().object};
+		}
+
 		if (value.is<sol::protected_function>())
 		{
 			return convert_function(value);
@@ -272,6 +465,63 @@ namespace scripting::lua
 		return {};
 	}
 
+	void push_arguments(argument_buffer& arguments, const sol::variadic_args& va)
+	{
+		for (const auto& arg : va)
+		{
+			auto* state = arg.lua_state();
+			const auto index = arg.stack_index();
+
+			game::VariableValue value{};
+
+			switch (lua_type(state, index))
+			{
+			case LUA_TNIL:
+			case LUA_TNONE:
+				value.type = game::SCRIPT_NONE;
+				arguments.push(value);
+				break;
+			case LUA_TBOOLEAN:
+				value.type = game::SCRIPT_INTEGER;
+				value.u.uintValue = lua_toboolean(state, index) ? 1 : 0;
+				arguments.push(value);
+				break;
+			case LUA_TNUMBER:
+			{
+				// Same split as convert, integral numbers become integers
+				const auto number = lua_tonumber(state, index);
+				if (std::floor(number) == number && number >= INT_MIN && number <= INT_MAX)
+				{
+					value.type = game::SCRIPT_INTEGER;
+					value.u.intValue = static_cast<int>(number);
+				}
+				else if (std::floor(number) == number && number >= 0 && number <= UINT_MAX)
+				{
+					value.type = game::SCRIPT_INTEGER;
+					value.u.uintValue = static_cast<unsigned int>(number);
+				}
+				else
+				{
+					value.type = game::SCRIPT_FLOAT;
+					value.u.floatValue = static_cast<float>(number);
+				}
+
+				arguments.push(value);
+				break;
+			}
+			case LUA_TSTRING:
+				value.type = game::SCRIPT_STRING;
+				value.u.stringValue = game::SL_GetString(lua_tostring(state, index), 0);
+				arguments.push(value);
+				game::RemoveRefToValue(value.type, value.u);
+				break;
+			default:
+				arguments.push(convert({state, arg}).get_raw());
+				break;
+			}
+		}
+	}
+
 	sol::lua_value convert(lua_State* state, const script_value& value)
 	{
 		if (value.is<int>())
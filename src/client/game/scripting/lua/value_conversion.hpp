@@ -1,11 +1,17 @@
 #pragma once
 
 #include "context.hpp"
+#include "../execution.hpp"
 
 namespace scripting::lua
 {
+	void setup_array_type(sol::state& state);
+
 	sol::lua_value entity_to_struct(lua_State* state, unsigned int parent_id);
 
 	script_value convert(const sol::lua_value& value);
 	sol::lua_value convert(lua_State* state, const script_value& value);
+
+	// Reads the values straight from their stack slots, no lua_value is created for plain types
+	void push_arguments(argument_buffer& arguments, const sol::variadic_args& va);
 }
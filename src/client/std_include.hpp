@@ -57,10 +57,15 @@
 #endif
 
 #include <map>
+#include <array>
+#include <bit>
+#include <bitset>
 #include <atomic>
 #include <vector>
 #include <mutex>
+#include <shared_mutex>
 #include <queue>
+#include <list>
 #include <regex>
 #include <chrono>
 #include <thread>
@@ -71,6 +76,7 @@
 #include <functional>
 #include <sstream>
 #include <optional>
+#include <span>
 #include <unordered_set>
 #include <variant>
 
@@ -1,8 +1,17 @@
 #include "string.hpp"
 #include "cryptography.hpp"
-#include "nt.hpp"
+#include <algorithm>
+#include <cstring>
 #include <gsl/gsl>
 
+#ifdef LTC_AES_NI
+#ifdef _WIN32
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
 #undef max
 using namespace std::string_literals;
 
@@ -20,6 +29,9 @@ namespace utils::cryptography
 
 				register_cipher(&aes_desc);
 				register_cipher(&des3_desc);
+#ifdef LTC_AES_NI
+				register_cipher(&aesni_desc);
+#endif
 
 				register_prng(&sprng_desc);
 				register_prng(&fortuna_desc);
@@ -56,6 +68,34 @@ namespace utils::cryptography
 			return static_cast<unsigned long>(value);
 		}
 
+		int find_aes_cipher()
+		{
+#ifdef LTC_AES_NI
+			static const auto has_aes_ni = []
+			{
+#ifdef _WIN32
+				int info[4]{};
+				__cpuid(info, 1);
+				return (info[2] & (1 << 25)) != 0;
+#else
+				unsigned int eax, ebx, ecx, edx;
+				return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_AES) != 0;
+#endif
+			}();
+
+			if (has_aes_ni)
+			{
+				const auto aesni = find_cipher("aesni");
+				if (aesni != -1)
+				{
+					return aesni;
+				}
+			}
+#endif
+
+			return find_cipher("aes");
+		}
+
 		class prng
 		{
 		public:
@@ -129,7 +169,7 @@ namespace utils::cryptography
 
 	ecc::key::key()
 	{
-		ZeroMemory(&this->key_storage_, sizeof(this->key_storage_));
+		std::memset(&this->key_storage_, 0, sizeof(this->key_storage_));
 	}
 
 	ecc::key::~key()
@@ -154,7 +194,7 @@ namespace utils::cryptography
 		if (this != &obj)
 		{
 			std::memmove(&this->key_storage_, &obj.key_storage_, sizeof(this->key_storage_));
-			ZeroMemory(&obj.key_storage_, sizeof(obj.key_storage_));
+			std::memset(&obj.key_storage_, 0, sizeof(obj.key_storage_));
 		}
 
 		return *this;
@@ -206,7 +246,7 @@ namespace utils::cryptography
 		                         ul(pub_key_buffer.size()),
 		                         &this->key_storage_) != CRYPT_OK)
 		{
-			ZeroMemory(&this->key_storage_, sizeof(this->key_storage_));
+			std::memset(&this->key_storage_, 0, sizeof(this->key_storage_));
 		}
 	}
 
@@ -218,7 +258,7 @@ namespace utils::cryptography
 		               &this->key_storage_) != CRYPT_OK
 		)
 		{
-			ZeroMemory(&this->key_storage_, sizeof(this->key_storage_));
+			std::memset(&this->key_storage_, 0, sizeof(this->key_storage_));
 		}
 	}
 
@@ -242,7 +282,7 @@ namespace utils::cryptography
 			ecc_free(&this->key_storage_);
 		}
 
-		ZeroMemory(&this->key_storage_, sizeof(this->key_storage_));
+		std::memset(&this->key_storage_, 0, sizeof(this->key_storage_));
 	}
 
 	bool ecc::key::operator==(key& key) const
@@ -451,13 +491,75 @@ namespace utils::cryptography
 		return string::dump_hex(hash, "");
 	}
 
+	aes::context::context() : state_(std::make_unique<symmetric_CBC>())
+	{
+	}
+
+	aes::context::context(const std::string& key) : context()
+	{
+		this->set_key(key);
+	}
+
+	aes::context::~context()
+	{
+		this->free();
+	}
+
+	bool aes::context::is_valid() const
+	{
+		return this->valid_;
+	}
+
+	void aes::context::set_key(const std::string& key)
+	{
+		this->set_key(cs(key.data()), key.size());
+	}
+
+	void aes::context::set_key(const uint8_t* key, const size_t length)
+	{
+		this->free();
+
+		constexpr uint8_t iv[16]{};
+		this->valid_ = cbc_start(find_aes_cipher(), iv, key, static_cast<int>(length), 0, this->state_.get()) ==
+			CRYPT_OK;
+	}
+
+	bool aes::context::encrypt(const uint8_t* data, const size_t length, const uint8_t* iv, uint8_t* output)
+	{
+		if (!this->valid_ || cbc_setiv(iv, 16, this->state_.get()) != CRYPT_OK)
+		{
+			return false;
+		}
+
+		return cbc_encrypt(data, output, ul(length), this->state_.get()) == CRYPT_OK;
+	}
+
+	bool aes::context::decrypt(const uint8_t* data, const size_t length, const uint8_t* iv, uint8_t* output)
+	{
+		if (!this->valid_ || cbc_setiv(iv, 16, this->state_.get()) != CRYPT_OK)
+		{
+			return false;
+		}
+
+		return cbc_decrypt(data, output, ul(length), this->state_.get()) == CRYPT_OK;
+	}
+
+	void aes::context::free()
+	{
+		if (this->valid_)
+		{
+			cbc_done(this->state_.get());
+			this->valid_ = false;
+		}
+	}
+
 	std::string aes::encrypt(const std::string& data, const std::string& iv, const std::string& key)
 	{
 		std::string enc_data;
 		enc_data.resize(data.size());
 
 		symmetric_CBC cbc;
-		const auto aes = find_cipher("aes");
+		const auto aes = find_aes_cipher();
 
 		cbc_start(aes, cs(iv.data()), cs(key.data()),
 		          static_cast<int>(key.size()), 0, &cbc);
@@ -475,7 +577,7 @@ namespace utils::cryptography
 		dec_data.resize(data.size());
 
 		symmetric_CBC cbc;
-		const auto aes = find_cipher("aes");
+		const auto aes = find_aes_cipher();
 
 		cbc_start(aes, cs(iv.data()), cs(key.data()),
 		          static_cast<int>(key.size()), 0, &cbc);
@@ -487,6 +589,58 @@ namespace utils::cryptography
 		return dec_data;
 	}
 
+	hmac_sha1::context::context() : state_(std::make_unique<hmac_state>())
+	{
+	}
+
+	hmac_sha1::context::context(const std::string& key) : context()
+	{
+		this->set_key(key);
+	}
+
+	bool hmac_sha1::context::is_valid() const
+	{
+		return this->valid_;
+	}
+
+	void hmac_sha1::context::set_key(const std::string& key)
+	{
+		this->set_key(cs(key.data()), key.size());
+	}
+
+	void hmac_sha1::context::set_key(const uint8_t* key, const size_t length)
+	{
+		this->valid_ = hmac_init(this->state_.get(), find_hash("sha1"), key, ul(length)) == CRYPT_OK;
+	}
+
+	bool hmac_sha1::context::compute(const uint8_t* data, const size_t length, uint8_t* output) const
+	{
+		if (!this->valid_)
+		{
+			return false;
+		}
+
+		// hmac_state is plain data, a copy resumes right after the keyed inner pad
+		auto state = *this->state_;
+		auto out_len = ul(digest_size);
+
+		return hmac_process(&state, data, ul(length)) == CRYPT_OK
+			&& hmac_done(&state, output, &out_len) == CRYPT_OK;
+	}
+
+	std::string hmac_sha1::context::compute(const std::string& data) const
+	{
+		std::string buffer;
+		buffer.resize(digest_size);
+
+		if (!this->compute(cs(data.data()), data.size(), cs(buffer.data())))
+		{
+			return {};
+		}
+
+		return buffer;
+	}
+
 	std::string hmac_sha1::compute(const std::string& data, const std::string& key)
 	{
 		std::string buffer;
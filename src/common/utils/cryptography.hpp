@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <memory>
 #include <tomcrypt.h>
 
 namespace utils::cryptography
@@ -69,12 +70,62 @@ namespace utils::cryptography
 
 	namespace aes
 	{
+		// CBC state with a cached key schedule, only the IV is reset per message
+		class context final
+		{
+		public:
+			context();
+			explicit context(const std::string& key);
+			~context();
+
+			context(context&&) = delete;
+			context(const context&) = delete;
+			context& operator=(context&&) = delete;
+			context& operator=(const context&) = delete;
+
+			bool is_valid() const;
+
+			void set_key(const std::string& key);
+			void set_key(const uint8_t* key, size_t length);
+
+			bool encrypt(const uint8_t* data, size_t length, const uint8_t* iv, uint8_t* output);
+			bool decrypt(const uint8_t* data, size_t length, const uint8_t* iv, uint8_t* output);
+
+			void free();
+
+		private:
+			std::unique_ptr<symmetric_CBC> state_;
+			bool valid_ = false;
+		};
+
 		std::string encrypt(const std::string& data, const std::string& iv, const std::string& key);
 		std::string decrypt(const std::string& data, const std::string& iv, const std::string& key);
 	}
 
 	namespace hmac_sha1
 	{
+		constexpr size_t digest_size = 20;
+
+		// Keeps the keyed inner state so each message only hashes its own data
+		class context final
+		{
+		public:
+			context();
+			explicit context(const std::string& key);
+
+			bool is_valid() const;
+
+			void set_key(const std::string& key);
+			void set_key(const uint8_t* key, size_t length);
+
+			bool compute(const uint8_t* data, size_t length, uint8_t* output) const;
+			std::string compute(const std::string& data) const;
+
+		private:
+			std::unique_ptr<hmac_state> state_;
+			bool valid_ = false;
+		};
+
 		std::string compute(const std::string& data, const std::string& key);
 	}
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "signature.hpp"
+#include "hook_transaction.hpp"
 
 #include <asmjit/core/jitruntime.h>
 #include <asmjit/x86/x86assembler.h>
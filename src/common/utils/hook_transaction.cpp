@@ -0,0 +1,306 @@
+#include "hook_transaction.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include "nt.hpp"
+#else
+#include <fstream>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace utils::hook
+{
+	namespace
+	{
+#ifdef _WIN32
+		class virtual_protect final : public page_protection
+		{
+		public:
+			size_t get_page_size() override
+			{
+				static const auto page_size = []
+				{
+					SYSTEM_INFO info{};
+					GetSystemInfo(&info);
+					return static_cast<size_t>(info.dwPageSize);
+				}();
+
+				return page_size;
+			}
+
+			bool unprotect(void* page, uint32_t* old_protection) override
+			{
+				DWORD protection{};
+				if (!VirtualProtect(page, this->get_page_size(), PAGE_EXECUTE_READWRITE, &protection))
+				{
+					return false;
+				}
+
+				*old_protection = protection;
+				return true;
+			}
+
+			void restore(void* page, const uint32_t old_protection) override
+			{
+				DWORD protection{};
+				VirtualProtect(page, this->get_page_size(), old_protection, &protection);
+			}
+
+			void flush_instruction_cache(void* start, const size_t length) override
+			{
+				FlushInstructionCache(GetCurrentProcess(), start, length);
+			}
+		};
+#else
+		class mprotect_protection final : public page_protection
+		{
+		public:
+			size_t get_page_size() override
+			{
+				return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+			}
+
+			bool unprotect(void* page, uint32_t* old_protection) override
+			{
+				const auto protection = get_protection(page);
+				if (protection < 0 || mprotect(page, this->get_page_size(), PROT_READ | PROT_WRITE | PROT_EXEC))
+				{
+					return false;
+				}
+
+				*old_protection = static_cast<uint32_t>(protection);
+				return true;
+			}
+
+			void restore(void* page, const uint32_t old_protection) override
+			{
+				mprotect(page, this->get_page_size(), static_cast<int>(old_protection));
+			}
+
+			void flush_instruction_cache(void* start, const size_t length) override
+			{
+				const auto* begin = static_cast<char*>(start);
+				__builtin___clear_cache(const_cast<char*>(begin), const_cast<char*>(begin + length));
+			}
+
+		private:
+			// mprotect can't report the current protection, so look it up in the mappings
+			static int get_protection(const void* page)
+			{
+				std::ifstream maps("/proc/self/maps");
+				const auto address = reinterpret_cast<uintptr_t>(page);
+
+				std::string line;
+				while (std::getline(maps, line))
+				{
+					unsigned long long start{}, end{};
+					char permissions[5]{};
+
+					if (sscanf(line.data(), "%llx-%llx %4s", &start, &end, permissions) != 3
+						|| address < start || address >= end)
+					{
+						continue;
+					}
+
+					auto protection = PROT_NONE;
+					if (permissions[0] == 'r') protection |= PROT_READ;
+					if (permissions[1] == 'w') protection |= PROT_WRITE;
+					if (permissions[2] == 'x') protection |= PROT_EXEC;
+					return protection;
+				}
+
+				return -1;
+			}
+		};
+#endif
+
+		int32_t get_relative_offset(const void* pointer, const void* data, const int offset)
+		{
+			const int64_t diff = size_t(data) - (size_t(pointer) + offset);
+			const auto small_diff = int32_t(diff);
+
+			if (diff != int64_t(small_diff))
+			{
+				throw std::runtime_error("Too far away to create 32bit relative branch");
+			}
+
+			return small_diff;
+		}
+	}
+
+	page_protection& page_protection::get_default()
+	{
+#ifdef _WIN32
+		static virtual_protect protection;
+#else
+		static mprotect_protection protection;
+#endif
+		return protection;
+	}
+
+	transaction::transaction(page_protection& protection) : protection_(protection)
+	{
+	}
+
+	void transaction::copy(void* place, const void* data, const size_t length)
+	{
+		if (!length)
+		{
+			return;
+		}
+
+		this->patches_.push_back({static_cast<uint8_t*>(place), this->data_.size(), length});
+		this->data_.append(static_cast<const uint8_t*>(data), length);
+	}
+
+	void transaction::copy(const size_t place, const void* data, const size_t length)
+	{
+		this->copy(reinterpret_cast<void*>(place), data, length);
+	}
+
+	void transaction::nop(void* place, const size_t length)
+	{
+		const std::basic_string<uint8_t> nops(length, 0x90);
+		this->copy(place, nops.data(), nops.size());
+	}
+
+	void transaction::nop(const size_t place, const size_t length)
+	{
+		this->nop(reinterpret_cast<void*>(place), length);
+	}
+
+	void transaction::call(void* pointer, void* data)
+	{
+		uint8_t instruction[5] = {0xE8};
+		const auto offset = get_relative_offset(pointer, data, 5);
+		std::memcpy(&instruction[1], &offset, sizeof(offset));
+
+		this->copy(pointer, instruction, sizeof(instruction));
+	}
+
+	void transaction::call(const size_t pointer, void* data)
+	{
+		this->call(reinterpret_cast<void*>(pointer), data);
+	}
+
+	void transaction::call(const size_t pointer, const size_t data)
+	{
+		this->call(pointer, reinterpret_cast<void*>(data));
+	}
+
+	void transaction::jump(void* pointer, void* data, const bool use_far)
+	{
+		if (use_far)
+		{
+			// mov rax, data; jmp rax
+			uint8_t instruction[12] = {0x48, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xE0};
+			std::memcpy(&instruction[2], &data, sizeof(data));
+
+			this->copy(pointer, instruction, sizeof(instruction));
+			return;
+		}
+
+		uint8_t instruction[5] = {0xE9};
+		const auto offset = get_relative_offset(pointer, data, 5);
+		std::memcpy(&instruction[1], &offset, sizeof(offset));
+
+		this->copy(pointer, instruction, sizeof(instruction));
+	}
+
+	void transaction::jump(const size_t pointer, void* data, const bool use_far)
+	{
+		this->jump(reinterpret_cast<void*>(pointer), data, use_far);
+	}
+
+	void transaction::jump(const size_t pointer, const size_t data, const bool use_far)
+	{
+		this->jump(pointer, reinterpret_cast<void*>(data), use_far);
+	}
+
+	void transaction::inject(void* pointer, const void* data)
+	{
+		this->set<int32_t>(pointer, get_relative_offset(pointer, data, 4));
+	}
+
+	void transaction::inject(const size_t pointer, const void* data)
+	{
+		this->inject(reinterpret_cast<void*>(pointer), data);
+	}
+
+	bool transaction::commit()
+	{
+		if (this->patches_.empty())
+		{
+			return true;
+		}
+
+		const auto page_size = this->protection_.get_page_size();
+		const auto page_of = [&](const uint8_t* address)
+		{
+			return reinterpret_cast<uint8_t*>(reinterpret_cast<uintptr_t>(address) & ~(page_size - 1));
+		};
+
+		std::vector<uint8_t*> pages;
+		auto* lowest = this->patches_.front().place;
+		auto* highest = lowest;
+
+		for (const auto& patch : this->patches_)
+		{
+			const auto* end = patch.place + patch.length;
+			for (auto* page = page_of(patch.place); page < end; page += page_size)
+			{
+				pages.push_back(page);
+			}
+
+			lowest = std::min(lowest, patch.place);
+			highest = std::max(highest, patch.place + patch.length);
+		}
+
+		std::sort(pages.begin(), pages.end());
+		pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+
+		std::vector<uint32_t> old_protections(pages.size());
+		size_t unprotected = 0;
+
+		for (; unprotected < pages.size(); ++unprotected)
+		{
+			if (!this->protection_.unprotect(pages[unprotected], &old_protections[unprotected]))
+			{
+				break;
+			}
+		}
+
+		const auto success = unprotected == pages.size();
+
+		if (success)
+		{
+			for (const auto& patch : this->patches_)
+			{
+				std::memmove(patch.place, this->data_.data() + patch.offset, patch.length);
+			}
+		}
+
+		for (size_t i = 0; i < unprotected; ++i)
+		{
+			this->protection_.restore(pages[i], old_protections[i]);
+		}
+
+		if (success)
+		{
+			this->protection_.flush_instruction_cache(lowest, size_t(highest - lowest));
+		}
+
+		this->patches_.clear();
+		this->data_.clear();
+
+		return success;
+	}
+
+	size_t transaction::size() const
+	{
+		return this->patches_.size();
+	}
+}
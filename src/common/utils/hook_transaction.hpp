@@ -0,0 +1,88 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace utils::hook
+{
+	// Makes code pages writable while patches are applied
+	class page_protection
+	{
+	public:
+		virtual ~page_protection() = default;
+
+		virtual size_t get_page_size() = 0;
+
+		// Makes the page writable, returning what has to be restored afterwards
+		virtual bool unprotect(void* page, uint32_t* old_protection) = 0;
+		virtual void restore(void* page, uint32_t old_protection) = 0;
+
+		virtual void flush_instruction_cache(void* start, size_t length) = 0;
+
+		// VirtualProtect on Windows, mprotect elsewhere
+		static page_protection& get_default();
+	};
+
+	// Records patches and applies them together, changing the protection of
+	// every touched page once and flushing the instruction cache once.
+	// Patches are only visible after commit, later ones win where they overlap.
+	// Patches that were never committed are dropped, so an exception while
+	// recording leaves the code untouched.
+	class transaction final
+	{
+	public:
+		explicit transaction(page_protection& protection = page_protection::get_default());
+		~transaction() = default;
+
+		transaction(transaction&&) = delete;
+		transaction(const transaction&) = delete;
+		transaction& operator=(transaction&&) = delete;
+		transaction& operator=(const transaction&) = delete;
+
+		void copy(void* place, const void* data, size_t length);
+		void copy(size_t place, const void* data, size_t length);
+
+		void nop(void* place, size_t length);
+		void nop(size_t place, size_t length);
+
+		void call(void* pointer, void* data);
+		void call(size_t pointer, void* data);
+		void call(size_t pointer, size_t data);
+
+		void jump(void* pointer, void* data, bool use_far = false);
+		void jump(size_t pointer, void* data, bool use_far = false);
+		void jump(size_t pointer, size_t data, bool use_far = false);
+
+		void inject(void* pointer, const void* data);
+		void inject(size_t pointer, const void* data);
+
+		template <typename T>
+		void set(void* place, T value)
+		{
+			this->copy(place, &value, sizeof(value));
+		}
+
+		template <typename T>
+		void set(const size_t place, T value)
+		{
+			this->set<T>(reinterpret_cast<void*>(place), value);
+		}
+
+		// Applies everything recorded so far. Nothing is written if a page can't be made writable.
+		[[nodiscard]] bool commit();
+
+		size_t size() const;
+
+	private:
+		struct patch
+		{
+			uint8_t* place;
+			size_t offset;
+			size_t length;
+		};
+
+		page_protection& protection_;
+		std::vector<patch> patches_;
+		std::basic_string<uint8_t> data_;
+	};
+}
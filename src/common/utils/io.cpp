@@ -1,17 +1,38 @@
 #include "io.hpp"
-#include "nt.hpp"
 #include <fstream>
 
+#ifdef _WIN32
+#include "nt.hpp"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace utils::io
 {
 	bool remove_file(const std::string& file)
 	{
+#ifdef _WIN32
 		return DeleteFileA(file.data()) == TRUE;
+#else
+		std::error_code ec;
+		return std::filesystem::remove(file, ec);
+#endif
 	}
 
 	bool move_file(const std::string& src, const std::string& target)
 	{
+#ifdef _WIN32
 		return MoveFileA(src.data(), target.data()) == TRUE;
+#else
+		if (std::filesystem::exists(target)) return false;
+
+		std::error_code ec;
+		std::filesystem::rename(src, target, ec);
+		return !ec;
+#endif
 	}
 
 	bool file_exists(const std::string& file)
@@ -28,7 +49,7 @@ namespace utils::io
 		}
 
 		std::ofstream stream(
-			file, std::ios::binary | std::ofstream::out | (append ? std::ofstream::app : 0));
+			file, std::ios::binary | std::ofstream::out | (append ? std::ofstream::app : std::ofstream::openmode{}));
 
 		if (stream.is_open())
 		{
@@ -40,6 +61,113 @@ namespace utils::io
 		return false;
 	}
 
+	namespace
+	{
+		// Only returns once the data reached the disk
+		bool write_file_durable(const std::string& file, const std::string& data, const bool append)
+		{
+			const auto pos = file.find_last_of("/\\");
+			if (pos != std::string::npos)
+			{
+				create_directory(file.substr(0, pos));
+			}
+
+#ifdef _WIN32
+			const auto handle = CreateFileA(file.data(), append ? FILE_APPEND_DATA : GENERIC_WRITE, FILE_SHARE_READ,
+			                                nullptr, append ? OPEN_ALWAYS : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL,
+			                                nullptr);
+			if (handle == INVALID_HANDLE_VALUE)
+			{
+				return false;
+			}
+
+			DWORD written = 0;
+			const auto result = WriteFile(handle, data.data(), static_cast<DWORD>(data.size()), &written, nullptr)
+				&& written == data.size() && FlushFileBuffers(handle);
+
+			CloseHandle(handle);
+			return result;
+#else
+			const auto fd = open(file.data(), O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC), 0644);
+			if (fd < 0)
+			{
+				return false;
+			}
+
+			size_t offset = 0;
+			while (offset < data.size())
+			{
+				const auto written = ::write(fd, data.data() + offset, data.size() - offset);
+				if (written <= 0)
+				{
+					close(fd);
+					return false;
+				}
+
+				offset += static_cast<size_t>(written);
+			}
+
+			const auto result = fsync(fd) == 0;
+			close(fd);
+			return result;
+#endif
+		}
+
+#ifndef _WIN32
+		// Makes a rename inside the directory survive a crash
+		bool sync_directory(const std::string& file)
+		{
+			const auto pos = file.find_last_of('/');
+			const auto directory = pos == std::string::npos ? std::string(".") : file.substr(0, std::max(pos, size_t(1)));
+
+			const auto fd = open(directory.data(), O_RDONLY | O_DIRECTORY);
+			if (fd < 0)
+			{
+				return false;
+			}
+
+			const auto result = fsync(fd) == 0;
+			close(fd);
+			return result;
+		}
+#endif
+	}
+
+	bool write_file_atomic(const std::string& file, const std::string& data)
+	{
+		// Readers see either the old or the new contents, never a torn file. The data
+		// is flushed before the rename, so a crash can't leave an empty file behind.
+		const auto temp_file = file + ".tmp";
+		if (!write_file_durable(temp_file, data, false))
+		{
+			remove_file(temp_file);
+			return false;
+		}
+
+#ifdef _WIN32
+		if (MoveFileExA(temp_file.data(), file.data(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) == FALSE)
+#else
+		std::error_code ec;
+		std::filesystem::rename(temp_file, file, ec); // rename(2) replaces atomically
+		if (ec)
+#endif
+		{
+			remove_file(temp_file);
+			return false;
+		}
+
+#ifndef _WIN32
+		sync_directory(file);
+#endif
+
+		return true;
+	}
+
+	bool append_file_durable(const std::string& file, const std::string& data)
+	{
+		return write_file_durable(file, data, true);
+	}
+
 	std::string read_file(const std::string& file)
 	{
 		std::string data;
@@ -122,4 +250,70 @@ namespace utils::io
 		                      std::filesystem::copy_options::overwrite_existing |
 		                      std::filesystem::copy_options::recursive);
 	}
+
+	mapped_file::mapped_file(const std::string& file)
+	{
+#ifdef _WIN32
+		this->file_ = CreateFileA(file.data(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+		                          OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (this->file_ == INVALID_HANDLE_VALUE)
+		{
+			this->file_ = nullptr;
+			return;
+		}
+
+		LARGE_INTEGER size{};
+		if (!GetFileSizeEx(this->file_, &size) || size.QuadPart == 0)
+		{
+			return;
+		}
+
+		this->mapping_ = CreateFileMappingA(this->file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!this->mapping_)
+		{
+			return;
+		}
+
+		this->data_ = MapViewOfFile(this->mapping_, FILE_MAP_READ, 0, 0, 0);
+		if (this->data_)
+		{
+			this->size_ = static_cast<size_t>(size.QuadPart);
+		}
+#else
+		const auto fd = open(file.data(), O_RDONLY);
+		if (fd < 0)
+		{
+			return;
+		}
+
+		struct stat info{};
+		if (fstat(fd, &info) == 0 && info.st_size > 0)
+		{
+			auto* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (data != MAP_FAILED)
+			{
+				this->data_ = data;
+				this->size_ = static_cast<size_t>(info.st_size);
+			}
+		}
+
+		close(fd);
+#endif
+	}
+
+	mapped_file::~mapped_file()
+	{
+#ifdef _WIN32
+		if (this->data_) UnmapViewOfFile(this->data_);
+		if (this->mapping_) CloseHandle(this->mapping_);
+		if (this->file_) CloseHandle(this->file_);
+#else
+		if (this->data_) munmap(this->data_, this->size_);
+#endif
+	}
+
+	std::string_view mapped_file::get_data() const
+	{
+		return {static_cast<const char*>(this->data_), this->size_};
+	}
 }
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <filesystem>
+#include <string_view>
 
 namespace utils::io
 {
@@ -10,6 +11,9 @@ namespace utils::io
 	bool move_file(const std::string& src, const std::string& target);
 	bool file_exists(const std::string& file);
 	bool write_file(const std::string& file, const std::string& data, bool append = false);
+	bool write_file_atomic(const std::string& file, const std::string& data);
+	// Appends and only returns once the data has reached the disk
+	bool append_file_durable(const std::string& file, const std::string& data);
 	bool read_file(const std::string& file, std::string* data);
 	std::string read_file(const std::string& file);
 	size_t file_size(const std::string& file);
@@ -18,4 +22,27 @@ namespace utils::io
 	bool directory_is_empty(const std::string& directory);
 	std::vector<std::string> list_files(const std::string& directory);
 	void copy_folder(const std::filesystem::path& src, const std::filesystem::path& target);
+
+	// Read-only view of a whole file, empty if it does not exist or can't be mapped
+	class mapped_file final
+	{
+	public:
+		explicit mapped_file(const std::string& file);
+		~mapped_file();
+
+		mapped_file(mapped_file&&) = delete;
+		mapped_file(const mapped_file&) = delete;
+		mapped_file& operator=(mapped_file&&) = delete;
+		mapped_file& operator=(const mapped_file&) = delete;
+
+		std::string_view get_data() const;
+
+	private:
+		void* data_ = nullptr;
+		size_t size_ = 0;
+#ifdef _WIN32
+		void* file_ = nullptr;
+		void* mapping_ = nullptr;
+#endif
+	};
 }
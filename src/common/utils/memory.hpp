@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mutex>
+#include <string>
 #include <vector>
 
 namespace utils
@@ -63,9 +64,11 @@ namespace utils
 
 		static bool is_set(const void* mem, char chr, size_t length);
 
+#ifdef _WIN32
 		static bool is_bad_read_ptr(const void* ptr);
 		static bool is_bad_code_ptr(const void* ptr);
 		static bool is_rdata_ptr(void* ptr);
+#endif
 
 		static allocator* get_allocator();
 
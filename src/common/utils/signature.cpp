@@ -1,58 +1,121 @@
 #include "signature.hpp"
-#include <thread>
-#include <mutex>
+#include "thread.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
 
+#ifdef _WIN32
 #include <intrin.h>
+#define SSE42_FUNCTION
+#else
+#include <cpuid.h>
+#include <immintrin.h>
+#define SSE42_FUNCTION __attribute__((target("sse4.2")))
+#endif
 
 namespace utils::hook
 {
-	void signature::load_pattern(const std::string& pattern)
+	namespace
 	{
-		this->mask_.clear();
-		this->pattern_.clear();
+		// Work is split into chunks this large, so all workers stay busy until the end
+		constexpr size_t chunk_size = 0x40000;
 
-		uint8_t nibble = 0;
-		auto has_nibble = false;
+		thread::pool& get_pool()
+		{
+			// Only use half of the available cores, the calling thread helps out too
+			static thread::pool pool(std::max(1u, std::thread::hardware_concurrency() / 2) - 1);
+			return pool;
+		}
 
-		for (auto val : pattern)
+		void parse_pattern(const std::string& pattern, std::string& mask, std::basic_string<uint8_t>& bytes)
 		{
-			if (val == ' ') continue;
-			if (val == '?')
-			{
-				this->mask_.push_back(val);
-				this->pattern_.push_back(0);
-			}
-			else
-			{
-				if ((val < '0' || val > '9') && (val < 'A' || val > 'F') && (val < 'a' || val > 'f'))
-				{
-					throw std::runtime_error("Invalid pattern");
-				}
+			mask.clear();
+			bytes.clear();
 
-				char str[] = {val, 0};
-				const auto current_nibble = static_cast<uint8_t>(strtol(str, nullptr, 16));
+			uint8_t nibble = 0;
+			auto has_nibble = false;
 
-				if (!has_nibble)
+			for (auto val : pattern)
+			{
+				if (val == ' ') continue;
+				if (val == '?')
 				{
-					has_nibble = true;
-					nibble = current_nibble;
+					mask.push_back(val);
+					bytes.push_back(0);
 				}
 				else
 				{
-					has_nibble = false;
-					const uint8_t byte = current_nibble | (nibble << 4);
-
-					this->mask_.push_back('x');
-					this->pattern_.push_back(byte);
+					if ((val < '0' || val > '9') && (val < 'A' || val > 'F') && (val < 'a' || val > 'f'))
+					{
+						throw std::runtime_error("Invalid pattern");
+					}
+
+					char str[] = {val, 0};
+					const auto current_nibble = static_cast<uint8_t>(strtol(str, nullptr, 16));
+
+					if (!has_nibble)
+					{
+						has_nibble = true;
+						nibble = current_nibble;
+					}
+					else
+					{
+						has_nibble = false;
+						const uint8_t byte = current_nibble | (nibble << 4);
+
+						mask.push_back('x');
+						bytes.push_back(byte);
+					}
 				}
 			}
+
+			while (!mask.empty() && mask.back() == '?')
+			{
+				mask.pop_back();
+				bytes.pop_back();
+			}
+
+			if (has_nibble)
+			{
+				throw std::runtime_error("Invalid pattern");
+			}
+		}
+
+		// Rough cost of anchoring on a byte, common filler and opcode bytes in x64 code score high
+		uint32_t get_byte_weight(const uint8_t byte)
+		{
+			switch (byte)
+			{
+			case 0x00:
+			case 0xCC:
+				return 8;
+			case 0xFF:
+			case 0x48:
+			case 0x8B:
+			case 0x89:
+			case 0x90:
+				return 4;
+			case 0x0F:
+			case 0x4C:
+			case 0xE8:
+			case 0x24:
+			case 0x44:
+				return 2;
+			default:
+				return 1;
+			}
 		}
 
-		while (!this->mask_.empty() && this->mask_.back() == '?')
+		uint16_t get_anchor_key(const uint8_t* address)
 		{
-			this->mask_.pop_back();
-			this->pattern_.pop_back();
+			return static_cast<uint16_t>((address[0] << 8) | address[1]);
 		}
+	}
+
+	void signature::load_pattern(const std::string& pattern)
+	{
+		parse_pattern(pattern, this->mask_, this->pattern_);
 
 		if (this->has_sse_support())
 		{
@@ -61,11 +124,6 @@ namespace utils::hook
 				this->pattern_.push_back(0);
 			}
 		}
-
-		if (has_nibble)
-		{
-			throw std::runtime_error("Invalid pattern");
-		}
 	}
 
 	std::vector<size_t> signature::process_range(uint8_t* start, const size_t length) const
@@ -100,10 +158,10 @@ namespace utils::hook
 		return result;
 	}
 
-	std::vector<size_t> signature::process_range_vectorized(uint8_t* start, const size_t length) const
+	SSE42_FUNCTION std::vector<size_t> signature::process_range_vectorized(uint8_t* start, const size_t length) const
 	{
 		std::vector<size_t> result;
-		__declspec(align(16)) char desired_mask[16] = {0};
+		alignas(16) char desired_mask[16] = {0};
 
 		for (size_t i = 0; i < this->mask_.size(); i++)
 		{
@@ -151,40 +209,23 @@ namespace utils::hook
 	{
 		const auto sub = this->has_sse_support() ? 16 : this->mask_.size();
 		const auto range = this->length_ - sub;
-		const auto cores = std::max(1u, std::thread::hardware_concurrency() / 2);
-		// Only use half of the available cores
-		const auto grid = range / cores;
+		const auto chunks = (range + chunk_size - 1) / chunk_size;
 
-		std::mutex mutex;
-		std::vector<size_t> result;
-		std::vector<std::thread> threads;
+		std::vector<std::vector<size_t>> chunk_results(chunks);
 
-		for (auto i = 0u; i < cores; ++i)
+		get_pool().run(chunks, [&](const size_t chunk)
 		{
-			const auto start = this->start_ + (grid * i);
-			const auto length = (i + 1 == cores) ? (this->start_ + this->length_ - sub) - start : grid;
-			threads.emplace_back([&, start, length]()
-			{
-				auto local_result = this->process_range(start, length);
-				if (local_result.empty()) return;
+			const auto offset = chunk * chunk_size;
+			chunk_results[chunk] = this->process_range(this->start_ + offset, std::min(chunk_size, range - offset));
+		});
 
-				std::lock_guard _(mutex);
-				for (const auto& address : local_result)
-				{
-					result.push_back(address);
-				}
-			});
-		}
-
-		for (auto& t : threads)
+		// Chunks are in address order, so the result is sorted already
+		std::vector<size_t> result;
+		for (auto& chunk_result : chunk_results)
 		{
-			if (t.joinable())
-			{
-				t.join();
-			}
+			result.insert(result.end(), chunk_result.begin(), chunk_result.end());
 		}
 
-		std::sort(result.begin(), result.end());
 		return {std::move(result)};
 	}
 
@@ -192,6 +233,7 @@ namespace utils::hook
 	{
 		if (this->mask_.size() <= 16)
 		{
+#ifdef _WIN32
 			int cpu_id[4];
 			__cpuid(cpu_id, 0);
 
@@ -200,13 +242,240 @@ namespace utils::hook
 				__cpuidex(cpu_id, 1, 0);
 				return (cpu_id[2] & (1 << 20)) != 0;
 			}
+#else
+			unsigned int eax, ebx, ecx, edx;
+			if (__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+			{
+				return (ecx & bit_SSE4_2) != 0;
+			}
+#endif
 		}
 
 		return false;
 	}
+
+	size_t signature_batch::add(const std::string& pattern)
+	{
+		signature_batch::pattern entry{};
+		parse_pattern(pattern, entry.mask, entry.bytes);
+
+		if (entry.mask.empty())
+		{
+			throw std::runtime_error("Invalid pattern");
+		}
+
+		// Prefer two fixed bytes in a row, but a single one will do
+		auto best_weight = std::numeric_limits<uint32_t>::max();
+
+		for (size_t i = 0; i < entry.mask.size(); ++i)
+		{
+			if (entry.mask[i] != 'x')
+			{
+				continue;
+			}
+
+			const auto is_pair = i + 1 < entry.mask.size() && entry.mask[i + 1] == 'x';
+			const auto weight = is_pair
+				                    ? get_byte_weight(entry.bytes[i]) * get_byte_weight(entry.bytes[i + 1])
+				                    : 0x100 * get_byte_weight(entry.bytes[i]);
+
+			if (weight < best_weight)
+			{
+				best_weight = weight;
+				entry.anchor = i;
+				entry.single_byte_anchor = !is_pair;
+			}
+		}
+
+		this->patterns_.emplace_back(std::move(entry));
+		return this->patterns_.size() - 1;
+	}
+
+	std::vector<signature::signature_result> signature_batch::process() const
+	{
+		struct candidate
+		{
+			uint32_t pattern;
+			uint32_t anchor;
+		};
+
+		// Candidates for an anchor key k are candidates[offsets[k], offsets[k + 1])
+		std::vector<uint32_t> offsets(0x10001, 0);
+		std::vector<uint64_t> present(0x10000 / 64, 0);
+
+		const auto for_each_key = [&](const pattern& entry, const auto& callback)
+		{
+			const auto first = static_cast<uint16_t>(entry.bytes[entry.anchor] << 8);
+
+			if (!entry.single_byte_anchor)
+			{
+				callback(static_cast<uint16_t>(first | entry.bytes[entry.anchor + 1]));
+				return;
+			}
+
+			for (uint32_t second = 0; second < 0x100; ++second)
+			{
+				callback(static_cast<uint16_t>(first | second));
+			}
+		};
+
+		for (const auto& entry : this->patterns_)
+		{
+			for_each_key(entry, [&](const uint16_t key)
+			{
+				++offsets[key + 1];
+				present[key / 64] |= 1ull << (key % 64);
+			});
+		}
+
+		for (size_t i = 1; i < offsets.size(); ++i)
+		{
+			offsets[i] += offsets[i - 1];
+		}
+
+		std::vector<candidate> candidates(offsets.back());
+		auto next = offsets;
+
+		for (size_t i = 0; i < this->patterns_.size(); ++i)
+		{
+			const auto& entry = this->patterns_[i];
+			for_each_key(entry, [&](const uint16_t key)
+			{
+				candidates[next[key]++] = {static_cast<uint32_t>(i), static_cast<uint32_t>(entry.anchor)};
+			});
+		}
+
+		const auto matches_at = [&](const candidate& candidate, const size_t position)
+		{
+			const auto& entry = this->patterns_[candidate.pattern];
+			if (position < candidate.anchor || entry.mask.size() > this->length_
+				|| position - candidate.anchor > this->length_ - entry.mask.size())
+			{
+				return false;
+			}
+
+			const auto* address = this->start_ + position - candidate.anchor;
+			for (size_t i = 0; i < entry.mask.size(); ++i)
+			{
+				if (entry.mask[i] == 'x' && entry.bytes[i] != address[i])
+				{
+					return false;
+				}
+			}
+
+			return true;
+		};
+
+		using match = std::pair<uint32_t, size_t>;
+
+		// Every anchor reads two bytes, the last byte can only hold a single byte anchor
+		const auto range = this->length_ > 0 ? this->length_ - 1 : 0;
+		const auto chunks = (range + chunk_size - 1) / chunk_size;
+
+		std::vector<std::vector<match>> chunk_matches(chunks);
+
+		const auto scan_chunk = [&](const size_t chunk)
+		{
+			const auto begin = chunk * chunk_size;
+			const auto end = std::min(begin + chunk_size, range);
+			auto& result = chunk_matches[chunk];
+
+			for (auto position = begin; position < end; ++position)
+			{
+				const auto key = get_anchor_key(this->start_ + position);
+				if (!(present[key / 64] & (1ull << (key % 64))))
+				{
+					continue;
+				}
+
+				for (auto i = offsets[key]; i < offsets[key + 1]; ++i)
+				{
+					const auto& candidate = candidates[i];
+					if (matches_at(candidate, position))
+					{
+						result.emplace_back(candidate.pattern, size_t(this->start_ + position - candidate.anchor));
+					}
+				}
+			}
+		};
+
+		if (chunks > 1)
+		{
+			get_pool().run(chunks, scan_chunk);
+		}
+		else if (chunks == 1)
+		{
+			scan_chunk(0);
+		}
+
+		std::vector<std::vector<size_t>> results(this->patterns_.size());
+
+		for (const auto& result : chunk_matches)
+		{
+			for (const auto& [pattern, address] : result)
+			{
+				results[pattern].push_back(address);
+			}
+		}
+
+		if (this->length_ > 0)
+		{
+			const auto last = this->length_ - 1;
+			for (size_t i = 0; i < this->patterns_.size(); ++i)
+			{
+				const auto& entry = this->patterns_[i];
+				const candidate candidate{static_cast<uint32_t>(i), static_cast<uint32_t>(entry.anchor)};
+
+				if (entry.single_byte_anchor && matches_at(candidate, last))
+				{
+					results[i].push_back(size_t(this->start_ + last - entry.anchor));
+				}
+			}
+		}
+
+		// Patterns anchored past their first byte can be found out of order across chunk borders
+		std::vector<signature::signature_result> signature_results;
+		signature_results.reserve(results.size());
+
+		for (auto& result : results)
+		{
+			std::sort(result.begin(), result.end());
+			signature_results.emplace_back(std::move(result));
+		}
+
+		return signature_results;
+	}
+
+	bool signature_batch::matches(const size_t index, const uint8_t* address) const
+	{
+		const auto& entry = this->patterns_.at(index);
+
+		if (address < this->start_ || address > this->start_ + this->length_
+			|| entry.mask.size() > size_t(this->start_ + this->length_ - address))
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < entry.mask.size(); ++i)
+		{
+			if (entry.mask[i] == 'x' && entry.bytes[i] != address[i])
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	size_t signature_batch::size() const
+	{
+		return this->patterns_.size();
+	}
 }
 
+#ifdef _WIN32
 utils::hook::signature::signature_result operator"" _sig(const char* str, const size_t len)
 {
 	return utils::hook::signature(std::string(str, len)).process();
 }
+#endif
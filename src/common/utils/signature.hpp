@@ -1,6 +1,12 @@
 #pragma once
+#ifdef _WIN32
 #include "nt.hpp"
+#endif
+
 #include <cstdint>
+#include <string>
+#include <vector>
+#include <stdexcept>
 
 namespace utils::hook
 {
@@ -33,10 +39,12 @@ namespace utils::hook
 			std::vector<size_t> matches_;
 		};
 
+#ifdef _WIN32
 		explicit signature(const std::string& pattern, const nt::library library = {})
 			: signature(pattern, library.get_ptr(), library.get_optional_header()->SizeOfImage)
 		{
 		}
+#endif
 
 		signature(const std::string& pattern, void* start, void* end)
 			: signature(pattern, start, size_t(end) - size_t(start))
@@ -68,6 +76,56 @@ namespace utils::hook
 
 		bool has_sse_support() const;
 	};
+
+	// Resolves many patterns in a single pass over the range. Every pattern is
+	// anchored on its least common pair of fixed bytes, so each offset costs one
+	// table probe and only offsets hitting an anchor are compared in full.
+	class signature_batch final
+	{
+	public:
+#ifdef _WIN32
+		explicit signature_batch(const nt::library library = {})
+			: signature_batch(library.get_ptr(), library.get_optional_header()->SizeOfImage)
+		{
+		}
+#endif
+
+		signature_batch(void* start, void* end)
+			: signature_batch(start, size_t(end) - size_t(start))
+		{
+		}
+
+		signature_batch(void* start, const size_t length)
+			: start_(static_cast<uint8_t*>(start)), length_(length)
+		{
+		}
+
+		// Returns the index of the pattern's result
+		size_t add(const std::string& pattern);
+
+		std::vector<signature::signature_result> process() const;
+
+		// Whether the pattern added at the index matches at the address
+		bool matches(size_t index, const uint8_t* address) const;
+
+		size_t size() const;
+
+	private:
+		struct pattern
+		{
+			std::string mask;
+			std::basic_string<uint8_t> bytes;
+			size_t anchor;
+			bool single_byte_anchor;
+		};
+
+		std::vector<pattern> patterns_;
+
+		uint8_t* start_;
+		size_t length_;
+	};
 }
 
+#ifdef _WIN32
 utils::hook::signature::signature_result operator"" _sig(const char* str, size_t len);
+#endif
@@ -0,0 +1,282 @@
+#include "signature_cache.hpp"
+#include "io.hpp"
+#include <cstring>
+
+namespace utils::hook
+{
+	namespace
+	{
+		constexpr char cache_magic[4] = {'S', 'I', 'G', 'C'};
+		constexpr uint32_t cache_version = 1;
+
+		constexpr uint64_t prime_1 = 0x9E3779B185EBCA87ull;
+		constexpr uint64_t prime_2 = 0xC2B2AE3D27D4EB4Full;
+
+		uint64_t rotate_left(const uint64_t value, const int bits)
+		{
+			return (value << bits) | (value >> (64 - bits));
+		}
+
+		uint64_t mix(const uint64_t lane, const uint64_t value)
+		{
+			return rotate_left(lane + value * prime_2, 31) * prime_1;
+		}
+
+		// Four independent lanes keep the multiplies pipelined, this runs at memory speed
+		uint64_t hash_range(const uint8_t* data, const size_t length, const uint64_t seed)
+		{
+			uint64_t lanes[4] = {seed + prime_1, seed + prime_2, seed, seed - prime_1};
+
+			size_t offset = 0;
+			for (; offset + 32 <= length; offset += 32)
+			{
+				for (size_t lane = 0; lane < 4; ++lane)
+				{
+					uint64_t value;
+					std::memcpy(&value, data + offset + lane * 8, sizeof(value));
+					lanes[lane] = mix(lanes[lane], value);
+				}
+			}
+
+			auto hash = rotate_left(lanes[0], 1) + rotate_left(lanes[1], 7) + rotate_left(lanes[2], 12) +
+				rotate_left(lanes[3], 18);
+
+			for (; offset < length; ++offset)
+			{
+				hash = rotate_left(hash ^ (data[offset] * prime_1), 11) * prime_2;
+			}
+
+			hash ^= length;
+			hash ^= hash >> 33;
+			hash *= prime_2;
+			hash ^= hash >> 29;
+			return hash;
+		}
+
+		template <typename T>
+		void write_value(std::string& buffer, const T& value)
+		{
+			buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+		}
+
+		template <typename T>
+		bool read_value(const std::string& buffer, size_t& offset, T* value)
+		{
+			if (buffer.size() - offset < sizeof(T))
+			{
+				return false;
+			}
+
+			std::memcpy(value, buffer.data() + offset, sizeof(T));
+			offset += sizeof(T);
+			return true;
+		}
+	}
+
+#ifdef _WIN32
+	signature_cache::signature_cache(std::string path, const nt::library& library)
+		: signature_cache(std::move(path), library.get_ptr(), library.get_optional_header()->SizeOfImage)
+	{
+		this->hashed_ranges_.clear();
+
+		for (const auto* section : library.get_section_headers())
+		{
+			if (section->Characteristics & IMAGE_SCN_MEM_WRITE)
+			{
+				continue;
+			}
+
+			this->hashed_ranges_.push_back({library.get_ptr() + section->VirtualAddress, section->Misc.VirtualSize});
+		}
+	}
+#endif
+
+	signature_cache::signature_cache(std::string path, void* start, const size_t length)
+		: path_(std::move(path)), start_(static_cast<uint8_t*>(start)), length_(length), batch_(start, length)
+	{
+		this->hashed_ranges_.push_back({this->start_, this->length_});
+	}
+
+	size_t signature_cache::add(const std::string& pattern)
+	{
+		this->patterns_.push_back(pattern);
+		return this->batch_.add(pattern);
+	}
+
+	std::vector<signature::signature_result> signature_cache::process()
+	{
+		const auto image_hash = this->get_image_hash();
+		const auto cached = this->load(image_hash);
+
+		std::vector<std::optional<signature::signature_result>> results(this->patterns_.size());
+		std::vector<size_t> misses;
+
+		for (size_t i = 0; i < this->patterns_.size(); ++i)
+		{
+			const auto entry = cached.find(this->patterns_[i]);
+			if (entry == cached.end())
+			{
+				misses.push_back(i);
+				continue;
+			}
+
+			std::vector<size_t> addresses;
+			addresses.reserve(entry->second.size());
+
+			auto valid = true;
+			for (const auto offset : entry->second)
+			{
+				const auto* address = this->start_ + offset;
+				if (offset >= this->length_ || !this->batch_.matches(i, address))
+				{
+					valid = false;
+					break;
+				}
+
+				addresses.push_back(size_t(address));
+			}
+
+			if (valid)
+			{
+				results[i].emplace(std::move(addresses));
+			}
+			else
+			{
+				misses.push_back(i);
+			}
+		}
+
+		this->scanned_ = misses.size();
+
+		if (!misses.empty())
+		{
+			signature_batch batch(this->start_, this->length_);
+			for (const auto index : misses)
+			{
+				batch.add(this->patterns_[index]);
+			}
+
+			auto scanned = batch.process();
+			for (size_t i = 0; i < misses.size(); ++i)
+			{
+				results[misses[i]].emplace(std::move(scanned[i]));
+			}
+		}
+
+		std::vector<signature::signature_result> signature_results;
+		signature_results.reserve(results.size());
+
+		for (auto& result : results)
+		{
+			signature_results.emplace_back(std::move(*result));
+		}
+
+		if (!misses.empty())
+		{
+			this->save(image_hash, signature_results);
+		}
+
+		return signature_results;
+	}
+
+	size_t signature_cache::get_scanned() const
+	{
+		return this->scanned_;
+	}
+
+	uint64_t signature_cache::get_image_hash() const
+	{
+		if (!this->image_hash_)
+		{
+			uint64_t hash = 0;
+			for (const auto& range : this->hashed_ranges_)
+			{
+				hash = hash_range(range.start, range.length, hash);
+			}
+
+			this->image_hash_ = hash;
+		}
+
+		return *this->image_hash_;
+	}
+
+	std::unordered_map<std::string, std::vector<size_t>> signature_cache::load(const uint64_t image_hash) const
+	{
+		std::string data;
+		if (!io::read_file(this->path_, &data) || data.size() < sizeof(cache_magic)
+			|| std::memcmp(data.data(), cache_magic, sizeof(cache_magic)))
+		{
+			return {};
+		}
+
+		size_t offset = sizeof(cache_magic);
+
+		uint32_t version;
+		uint64_t hash;
+		uint32_t count;
+
+		if (!read_value(data, offset, &version) || version != cache_version
+			|| !read_value(data, offset, &hash) || hash != image_hash
+			|| !read_value(data, offset, &count))
+		{
+			return {};
+		}
+
+		std::unordered_map<std::string, std::vector<size_t>> entries;
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			uint32_t pattern_length;
+			if (!read_value(data, offset, &pattern_length) || data.size() - offset < pattern_length)
+			{
+				return {};
+			}
+
+			auto pattern = data.substr(offset, pattern_length);
+			offset += pattern_length;
+
+			uint32_t match_count;
+			if (!read_value(data, offset, &match_count) || (data.size() - offset) / sizeof(uint64_t) < match_count)
+			{
+				return {};
+			}
+
+			std::vector<size_t> offsets(match_count);
+			for (auto& match : offsets)
+			{
+				uint64_t value{};
+				read_value(data, offset, &value);
+				match = static_cast<size_t>(value);
+			}
+
+			entries[std::move(pattern)] = std::move(offsets);
+		}
+
+		return entries;
+	}
+
+	void signature_cache::save(const uint64_t image_hash, const std::vector<signature::signature_result>& results) const
+	{
+		std::string data(cache_magic, sizeof(cache_magic));
+		write_value(data, cache_version);
+		write_value(data, image_hash);
+		write_value(data, static_cast<uint32_t>(this->patterns_.size()));
+
+		for (size_t i = 0; i < this->patterns_.size(); ++i)
+		{
+			const auto& pattern = this->patterns_[i];
+			write_value(data, static_cast<uint32_t>(pattern.size()));
+			data.append(pattern);
+
+			const auto& result = results[i];
+			write_value(data, static_cast<uint32_t>(result.count()));
+
+			for (size_t j = 0; j < result.count(); ++j)
+			{
+				write_value(data, static_cast<uint64_t>(result.get(j) - this->start_));
+			}
+		}
+
+		io::write_file_atomic(this->path_, data);
+	}
+}
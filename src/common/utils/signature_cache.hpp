@@ -0,0 +1,54 @@
+#pragma once
+#include "signature.hpp"
+
+#include <optional>
+#include <unordered_map>
+
+namespace utils::hook
+{
+	// Remembers where patterns were found, keyed by a hash of the image, so
+	// later runs against the same binary skip scanning. Cached addresses are
+	// checked against the pattern bytes before they are used, and anything
+	// that fails the check is scanned for again. The image has to be hashed
+	// before it is patched, so process this before installing any hooks.
+	class signature_cache final
+	{
+	public:
+#ifdef _WIN32
+		// Only hashes sections that are not writable
+		signature_cache(std::string path, const nt::library& library);
+#endif
+
+		signature_cache(std::string path, void* start, size_t length);
+
+		size_t add(const std::string& pattern);
+
+		std::vector<signature::signature_result> process();
+
+		// How many patterns the last process call had to scan for
+		size_t get_scanned() const;
+
+		uint64_t get_image_hash() const;
+
+	private:
+		struct range
+		{
+			const uint8_t* start;
+			size_t length;
+		};
+
+		std::string path_;
+		uint8_t* start_;
+		size_t length_;
+		std::vector<range> hashed_ranges_;
+
+		std::vector<std::string> patterns_;
+		signature_batch batch_;
+
+		mutable std::optional<uint64_t> image_hash_;
+		size_t scanned_ = 0;
+
+		std::unordered_map<std::string, std::vector<size_t>> load(uint64_t image_hash) const;
+		void save(uint64_t image_hash, const std::vector<signature::signature_result>& results) const;
+	};
+}
@@ -3,7 +3,9 @@
 #include <cstdarg>
 #include <algorithm>
 
+#ifdef _WIN32
 #include "nt.hpp"
+#endif
 
 namespace utils::string
 {
@@ -84,6 +86,7 @@ namespace utils::string
 
 	std::string get_clipboard_data()
 	{
+#ifdef _WIN32
 		if (OpenClipboard(nullptr))
 		{
 			std::string data;
@@ -102,6 +105,7 @@ namespace utils::string
 
 			return data;
 		}
+#endif
 		return {};
 	}
 
@@ -1,12 +1,17 @@
 #include "thread.hpp"
 #include "string.hpp"
 
+#ifdef _WIN32
 #include <TlHelp32.h>
 
 #include <gsl/gsl>
+#else
+#include <pthread.h>
+#endif
 
 namespace utils::thread
 {
+#ifdef _WIN32
 	bool set_name(const HANDLE t, const std::string& name)
 	{
 		const nt::library kernel32("kernel32.dll");
@@ -37,16 +42,28 @@ namespace utils::thread
 		return set_name(t, name);
 	}
 
+#endif
+
 	bool set_name(std::thread& t, const std::string& name)
 	{
+#ifdef _WIN32
 		return set_name(t.native_handle(), name);
+#else
+		// pthread names are limited to 15 characters
+		return pthread_setname_np(t.native_handle(), name.substr(0, 15).data()) == 0;
+#endif
 	}
 
 	bool set_name(const std::string& name)
 	{
+#ifdef _WIN32
 		return set_name(GetCurrentThread(), name);
+#else
+		return pthread_setname_np(pthread_self(), name.substr(0, 15).data()) == 0;
+#endif
 	}
 
+#ifdef _WIN32
 	std::vector<DWORD> get_thread_ids()
 	{
 		auto* const h = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, GetCurrentProcessId());
@@ -125,4 +142,111 @@ namespace utils::thread
 			}
 		});
 	}
+#endif
+
+	pool::pool(const size_t threads)
+	{
+		this->threads_.reserve(threads);
+		for (size_t i = 0; i < threads; ++i)
+		{
+			this->threads_.emplace_back(create_named_thread("Worker", [this]
+			{
+				this->worker_main();
+			}));
+		}
+	}
+
+	pool::~pool()
+	{
+		{
+			std::lock_guard<std::mutex> _(this->mutex_);
+			this->stopping_ = true;
+		}
+
+		this->work_cv_.notify_all();
+
+		for (auto& thread : this->threads_)
+		{
+			if (thread.joinable())
+			{
+				thread.join();
+			}
+		}
+	}
+
+	void pool::run(const size_t count, const std::function<void(size_t)>& callback)
+	{
+		std::lock_guard<std::mutex> _(this->run_mutex_);
+
+		{
+			std::lock_guard<std::mutex> __(this->mutex_);
+			this->callback_ = &callback;
+			this->count_ = count;
+			this->next_ = 0;
+			this->finished_ = 0;
+			++this->generation_;
+		}
+
+		this->work_cv_.notify_all();
+		this->work();
+
+		// Every worker has to see the job through before the callback goes away
+		std::unique_lock<std::mutex> lock(this->mutex_);
+		this->done_cv_.wait(lock, [this]
+		{
+			return this->finished_ == this->threads_.size();
+		});
+
+		this->callback_ = nullptr;
+	}
+
+	size_t pool::size() const
+	{
+		return this->threads_.size();
+	}
+
+	void pool::work()
+	{
+		while (true)
+		{
+			const auto index = this->next_++;
+			if (index >= this->count_)
+			{
+				break;
+			}
+
+			(*this->callback_)(index);
+		}
+	}
+
+	void pool::worker_main()
+	{
+		uint64_t generation = 0;
+		std::unique_lock<std::mutex> lock(this->mutex_);
+
+		while (true)
+		{
+			this->work_cv_.wait(lock, [&]
+			{
+				return this->stopping_ || this->generation_ != generation;
+			});
+
+			if (this->stopping_)
+			{
+				return;
+			}
+
+			generation = this->generation_;
+
+			lock.unlock();
+			this->work();
+			lock.lock();
+
+			if (++this->finished_ == this->threads_.size())
+			{
+				this->done_cv_.notify_all();
+			}
+		}
+	}
 }
+
@@ -1,11 +1,22 @@
 #pragma once
 #include <thread>
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+#ifdef _WIN32
 #include "nt.hpp"
+#endif
 
 namespace utils::thread
 {
+#ifdef _WIN32
 	bool set_name(HANDLE t, const std::string& name);
 	bool set_name(DWORD id, const std::string& name);
+#endif
 	bool set_name(std::thread& t, const std::string& name);
 	bool set_name(const std::string& name);
 
@@ -17,9 +28,50 @@ namespace utils::thread
 		return t;
 	}
 
+#ifdef _WIN32
 	std::vector<DWORD> get_thread_ids();
 	void for_each_thread(const std::function<void(HANDLE)>& callback);
 
 	void suspend_other_threads();
 	void resume_other_threads();
+#endif
+
+	// Long-lived workers for splitting work into independent tasks,
+	// so repeated parallel jobs don't pay for spawning threads
+	class pool final
+	{
+	public:
+		explicit pool(size_t threads);
+		~pool();
+
+		pool(pool&&) = delete;
+		pool(const pool&) = delete;
+		pool& operator=(pool&&) = delete;
+		pool& operator=(const pool&) = delete;
+
+		// Calls the callback for every index in [0, count) on the workers and
+		// the calling thread, returning once all of them are done
+		void run(size_t count, const std::function<void(size_t)>& callback);
+
+		size_t size() const;
+
+	private:
+		std::mutex run_mutex_;
+
+		std::mutex mutex_;
+		std::condition_variable work_cv_;
+		std::condition_variable done_cv_;
+		uint64_t generation_ = 0;
+		size_t finished_ = 0;
+		bool stopping_ = false;
+
+		const std::function<void(size_t)>* callback_ = nullptr;
+		size_t count_ = 0;
+		std::atomic<size_t> next_{0};
+
+		std::vector<std::thread> threads_;
+
+		void work();
+		void worker_main();
+	};
 }
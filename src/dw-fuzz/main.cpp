@@ -0,0 +1,300 @@
+#include <std_include.hpp>
+
+#include "game/demonware/byte_buffer.hpp"
+#include "game/demonware/byte_reader.hpp"
+#include "game/demonware/byte_writer.hpp"
+
+namespace
+{
+	void check(const bool condition, const char* message)
+	{
+		if (!condition)
+		{
+			fprintf(stderr, "check failed: %s\n", message);
+			abort();
+		}
+	}
+
+	enum class operation
+	{
+		byte,
+		boolean,
+		int16,
+		uint16,
+		int32,
+		uint32,
+		int64,
+		uint64,
+		floating,
+		string,
+		blob,
+		array_header,
+		skip,
+		toggle_data_types,
+		count,
+	};
+
+	// Writes a value that was just read and reads it back through a fresh reader
+	template <typename T, typename Write, typename Read>
+	void round_trip(const bool use_data_types, const T& value, Write&& write, Read&& read,
+	                const std::string_view consumed, const bool exact)
+	{
+		std::string buffer;
+		demonware::byte_writer writer(buffer);
+		writer.set_use_data_types(use_data_types);
+		write(writer, value);
+
+		if (exact)
+		{
+			check(buffer == consumed, "written bytes differ from the bytes read");
+		}
+
+		demonware::byte_reader reader(std::string_view{buffer});
+		reader.set_use_data_types(use_data_types);
+
+		T result{};
+		check(read(reader, &result), "reading back a written value failed");
+		check(!reader.has_more_data(), "reading back left data behind");
+
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			check(std::memcmp(&result, &value, sizeof(T)) == 0, "float round trip changed the value");
+		}
+		else
+		{
+			check(result == value, "round trip changed the value");
+		}
+	}
+
+	template <typename T, typename U>
+	void typed(demonware::byte_reader& reader, const std::string_view input,
+	           bool (demonware::byte_reader::*read)(T*), bool (demonware::byte_writer::*write)(U), const bool exact = true)
+	{
+		const auto start = reader.offset();
+
+		T value{};
+		if (!(reader.*read)(&value))
+		{
+			check(reader.offset() == start, "failed read advanced the cursor");
+			return;
+		}
+
+		check(reader.offset() > start && reader.offset() <= reader.size(), "cursor out of range");
+
+		round_trip(reader.is_using_data_types(), value, [&](demonware::byte_writer& writer, const T& v)
+		           {
+			           (writer.*write)(static_cast<U>(v));
+		           }, [&](demonware::byte_reader& r, T* v)
+		           {
+			           return (r.*read)(v);
+		           }, input.substr(start, reader.offset() - start), exact);
+	}
+
+	void run_operation(demonware::byte_reader& reader, const std::string_view input, const operation op,
+	                   const uint8_t argument)
+	{
+		using demonware::byte_reader;
+		using demonware::byte_writer;
+
+		const auto start = reader.offset();
+
+		switch (op)
+		{
+		case operation::byte: return typed(reader, input, &byte_reader::read_byte, &byte_writer::write_byte);
+		case operation::boolean: return typed(reader, input, &byte_reader::read_bool, &byte_writer::write_bool, false);
+		case operation::int16: return typed(reader, input, &byte_reader::read_int16, &byte_writer::write_int16);
+		case operation::uint16: return typed(reader, input, &byte_reader::read_uint16, &byte_writer::write_uint16);
+		case operation::int32: return typed(reader, input, &byte_reader::read_int32, &byte_writer::write_int32);
+		case operation::uint32: return typed(reader, input, &byte_reader::read_uint32, &byte_writer::write_uint32);
+		case operation::int64: return typed(reader, input, &byte_reader::read_int64, &byte_writer::write_int64);
+		case operation::uint64: return typed(reader, input, &byte_reader::read_uint64, &byte_writer::write_uint64);
+		case operation::floating: return typed(reader, input, &byte_reader::read_float, &byte_writer::write_float);
+
+		case operation::string:
+		case operation::blob:
+		{
+			const auto is_string = op == operation::string;
+
+			std::string_view value;
+			if (!(is_string ? reader.read_string(&value) : reader.read_blob(&value)))
+			{
+				check(reader.offset() == start, "failed read advanced the cursor");
+				return;
+			}
+
+			check(value.data() >= input.data() && value.data() + value.size() <= input.data() + input.size(),
+			      "view points outside the input");
+
+			round_trip(reader.is_using_data_types(), value, [&](byte_writer& writer, const std::string_view v)
+			           {
+				           is_string ? writer.write_string(v) : writer.write_blob(v);
+			           }, [&](byte_reader& r, std::string_view* v)
+			           {
+				           return is_string ? r.read_string(v) : r.read_blob(v);
+			           }, input.substr(start, reader.offset() - start), true);
+			return;
+		}
+
+		case operation::array_header:
+		{
+			unsigned int count = 0xCDCDCDCD, size = 0xCDCDCDCD;
+			if (!reader.read_array_header(argument, &count, &size))
+			{
+				check(reader.offset() == start, "failed read advanced the cursor");
+				check(count == 0xCDCDCDCD && size == 0xCDCDCDCD, "failed read touched the output");
+				return;
+			}
+
+			check(reader.offset() <= reader.size(), "cursor out of range");
+			return;
+		}
+
+		case operation::skip:
+			if (!reader.skip(argument))
+			{
+				check(reader.offset() == start, "failed skip advanced the cursor");
+			}
+			return;
+
+		case operation::toggle_data_types:
+			reader.set_use_data_types(!reader.is_using_data_types());
+			return;
+
+		case operation::count:
+			break;
+		}
+	}
+
+	// Services still parse their requests with byte_buffer, its reads have to stay inside the data as well
+	void run_operation(demonware::byte_buffer& buffer, const operation op, const uint8_t argument)
+	{
+		const auto& data = buffer.get_buffer();
+		const auto inside = [&](const char* pointer, const size_t length)
+		{
+			return pointer >= data.data() && length <= data.size() && pointer <= data.data() + data.size() - length;
+		};
+
+		std::array<uint8_t, 256> scratch{};
+
+		switch (op)
+		{
+		case operation::byte: buffer.read_byte(scratch.data()); break;
+		case operation::boolean: buffer.read_bool(reinterpret_cast<bool*>(scratch.data())); break;
+		case operation::int16: buffer.read_int16(reinterpret_cast<short*>(scratch.data())); break;
+		case operation::uint16: buffer.read_uint16(reinterpret_cast<unsigned short*>(scratch.data())); break;
+		case operation::int32: buffer.read_int32(reinterpret_cast<int*>(scratch.data())); break;
+		case operation::uint32: buffer.read_uint32(reinterpret_cast<unsigned int*>(scratch.data())); break;
+		case operation::int64: buffer.read_int64(reinterpret_cast<int64_t*>(scratch.data())); break;
+		case operation::uint64: buffer.read_uint64(reinterpret_cast<uint64_t*>(scratch.data())); break;
+		case operation::floating: buffer.read_float(reinterpret_cast<float*>(scratch.data())); break;
+
+		case operation::string:
+		{
+			char* value;
+			if (buffer.read_string(&value))
+			{
+				check(inside(value, strlen(value) + 1), "string points outside the buffer");
+			}
+			break;
+		}
+
+		case operation::blob:
+		{
+			char* value;
+			int length;
+			if (buffer.read_blob(&value, &length))
+			{
+				check(length >= 0 && inside(value, static_cast<size_t>(length)), "blob points outside the buffer");
+			}
+			break;
+		}
+
+		case operation::array_header:
+		{
+			unsigned int count, size;
+			buffer.read_array_header(argument, &count, &size);
+			break;
+		}
+
+		case operation::skip: buffer.read(argument, scratch.data()); break;
+		case operation::toggle_data_types: buffer.set_use_data_types(!buffer.is_using_data_types()); break;
+		case operation::count: break;
+		}
+
+		check(buffer.get_remaining().size() <= data.size(), "cursor out of range");
+		check(buffer.has_more_data() == !buffer.get_remaining().empty(), "cursor out of range");
+	}
+}
+
+// The first byte is the number of operations, followed by one (operation, argument)
+// pair each. Everything after that is the data the operations parse.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, const size_t size)
+{
+	if (!size)
+	{
+		return 0;
+	}
+
+	const auto operation_count = std::min(static_cast<size_t>(data[0]), (size - 1) / 2);
+	const auto* operations = data + 1;
+
+	const std::string_view input(reinterpret_cast<const char*>(operations + operation_count * 2),
+	                             size - 1 - operation_count * 2);
+
+	demonware::byte_reader reader(std::span(reinterpret_cast<const std::byte*>(input.data()), input.size()));
+
+	for (size_t i = 0; i < operation_count; ++i)
+	{
+		const auto op = static_cast<operation>(operations[i * 2] % static_cast<uint8_t>(operation::count));
+		run_operation(reader, input, op, operations[i * 2 + 1]);
+
+		check(reader.offset() + reader.remaining() == reader.size(), "offset and remaining disagree");
+		check(reader.get_remaining() == input.substr(reader.offset()), "remaining view is wrong");
+	}
+
+	demonware::byte_buffer buffer{std::string(input)};
+	for (size_t i = 0; i < operation_count; ++i)
+	{
+		const auto op = static_cast<operation>(operations[i * 2] % static_cast<uint8_t>(operation::count));
+		run_operation(buffer, op, operations[i * 2 + 1]);
+	}
+
+	return 0;
+}
+
+#ifndef LIBFUZZER
+// Without libFuzzer, replays the given inputs or runs random ones
+int main(const int argc, char** argv)
+{
+	if (argc > 1)
+	{
+		for (auto i = 1; i < argc; ++i)
+		{
+			std::ifstream stream(argv[i], std::ios::binary);
+			const std::string data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+			LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+		}
+
+		printf("replayed %d inputs\n", argc - 1);
+		return 0;
+	}
+
+	std::mt19937 random(1337);
+	constexpr size_t runs = 200000;
+
+	for (size_t run = 0; run < runs; ++run)
+	{
+		std::vector<uint8_t> data(random() % 256);
+		for (auto& byte : data)
+		{
+			// Mostly small values, so type tags and lengths line up often
+			byte = static_cast<uint8_t>(random() % 3 ? random() % 24 : random());
+		}
+
+		LLVMFuzzerTestOneInput(data.data(), data.size());
+	}
+
+	printf("ran %zu random inputs\n", runs);
+	return 0;
+}
+#endif
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <random>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <span>
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+using namespace std::literals;
@@ -0,0 +1,191 @@
+#include <std_include.hpp>
+#include "bench_client.hpp"
+#include "lobby_client.hpp"
+
+#include "game/demonware/byte_buffer.hpp"
+
+namespace host
+{
+	namespace
+	{
+		using clock = std::chrono::steady_clock;
+
+		struct request
+		{
+			uint8_t service;
+			uint8_t task;
+			std::function<void(demonware::byte_buffer&)> write_arguments;
+		};
+
+		// Roughly what the game sends right after logging in
+		std::vector<request> build_requests(const size_t client)
+		{
+			const auto filename = "bench_" + std::to_string(client) + ".dat";
+			const auto owner = 0x1100001DEADBEEF + client;
+
+			return {
+				{
+					12, 6, [](demonware::byte_buffer&)
+					{
+					}
+				},
+				{
+					10, 6, [](demonware::byte_buffer& buffer)
+					{
+						buffer.write_uint32(0);
+						buffer.write_uint16(10);
+						buffer.write_uint16(0);
+						buffer.write_string("motd-english.txt");
+					}
+				},
+				{
+					10, 7, [](demonware::byte_buffer& buffer)
+					{
+						buffer.write_string("playlists_tu22.aggr");
+					}
+				},
+				{
+					10, 10, [=](demonware::byte_buffer& buffer)
+					{
+						buffer.write_string("s1");
+						buffer.write_string(filename);
+						buffer.write_bool(false);
+						buffer.write_blob(std::string(256, static_cast<char>(client)));
+						buffer.write_uint64(owner);
+					}
+				},
+				{
+					10, 12, [=](demonware::byte_buffer& buffer)
+					{
+						buffer.write_string("s1");
+						buffer.write_string(filename);
+						buffer.write_uint64(owner);
+						buffer.write_string("steam");
+					}
+				},
+				{
+					4, 1, [](demonware::byte_buffer&)
+					{
+					}
+				},
+			};
+		}
+
+		// Typed task id followed by the task arguments
+		std::string build_payload(const request& call)
+		{
+			demonware::byte_buffer payload;
+			payload.write_byte(static_cast<char>(call.task));
+			call.write_arguments(payload);
+			return payload.get_buffer();
+		}
+
+		struct client_result
+		{
+			std::vector<std::chrono::nanoseconds> latencies;
+			size_t error_replies = 0;
+			std::string failure;
+		};
+
+		void run_client(const bench_options& options, const size_t client, client_result& result)
+		{
+			try
+			{
+				lobby_client lobby(options.address, options.port, client);
+
+				std::vector<std::pair<uint8_t, std::string>> requests;
+				for (const auto& call : build_requests(client))
+				{
+					requests.emplace_back(call.service, build_payload(call));
+				}
+
+				result.latencies.reserve(options.requests);
+
+				for (size_t i = 0; i < options.requests; ++i)
+				{
+					const auto& [service, payload] = requests[i % requests.size()];
+					const auto packet = lobby.build_call(service, payload);
+
+					const auto start = clock::now();
+					const auto reply = lobby.exchange(packet);
+					result.latencies.push_back(clock::now() - start);
+
+					if (reply.error)
+					{
+						++result.error_replies;
+					}
+				}
+			}
+			catch (const std::exception& e)
+			{
+				result.failure = e.what();
+			}
+		}
+
+		double to_microseconds(const std::chrono::nanoseconds duration)
+		{
+			return std::chrono::duration<double, std::micro>(duration).count();
+		}
+	}
+
+	bool run_bench(const bench_options& options)
+	{
+		std::vector<client_result> results(options.clients);
+		std::vector<std::thread> threads;
+		threads.reserve(options.clients);
+
+		const auto start = clock::now();
+
+		for (size_t i = 0; i < options.clients; ++i)
+		{
+			threads.emplace_back(run_client, std::cref(options), i, std::ref(results[i]));
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		const auto elapsed = clock::now() - start;
+
+		std::vector<std::chrono::nanoseconds> latencies;
+		size_t error_replies = 0;
+		size_t failed_clients = 0;
+
+		for (auto& result : results)
+		{
+			latencies.insert(latencies.end(), result.latencies.begin(), result.latencies.end());
+			error_replies += result.error_replies;
+
+			if (!result.failure.empty())
+			{
+				++failed_clients;
+				printf("client failed: %s\n", result.failure.data());
+			}
+		}
+
+		if (latencies.empty())
+		{
+			printf("no requests completed\n");
+			return false;
+		}
+
+		std::sort(latencies.begin(), latencies.end());
+
+		const auto percentile = [&](const double p)
+		{
+			const auto index = static_cast<size_t>(p * static_cast<double>(latencies.size() - 1));
+			return to_microseconds(latencies[index]);
+		};
+
+		const auto seconds = std::chrono::duration<double>(elapsed).count();
+
+		printf("clients: %zu (%zu failed), requests: %zu, error replies: %zu\n", options.clients, failed_clients,
+		       latencies.size(), error_replies);
+		printf("elapsed: %.3f s, throughput: %.0f req/s\n", seconds, static_cast<double>(latencies.size()) / seconds);
+		printf("latency us: p50 %.1f, p90 %.1f, p99 %.1f, p99.9 %.1f, max %.1f\n", percentile(0.5), percentile(0.9),
+		       percentile(0.99), percentile(0.999), to_microseconds(latencies.back()));
+
+		return failed_clients == 0;
+	}
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace host
+{
+	struct bench_options
+	{
+		std::string address = "127.0.0.1";
+		uint16_t port = 3074;
+		size_t clients = 16;
+		size_t requests = 1000;
+	};
+
+	// Replays the game's login handshake and a mix of service calls from
+	// concurrent clients, then prints throughput and latency percentiles.
+	bool run_bench(const bench_options& options);
+}
@@ -0,0 +1,422 @@
+#include <std_include.hpp>
+#include "bit_buffer_bench.hpp"
+
+#include "game/demonware/bit_buffer.hpp"
+
+namespace host
+{
+	namespace
+	{
+		using clock = std::chrono::steady_clock;
+
+		// bit_buffer as it was before the 64-bit accumulator, kept as the reference
+		class legacy_bit_buffer final
+		{
+		public:
+			legacy_bit_buffer() = default;
+
+			explicit legacy_bit_buffer(std::string buffer) : buffer_(std::move(buffer))
+			{
+			}
+
+			bool read_bool(bool* output)
+			{
+				if (!this->read_data_type(1))
+				{
+					return false;
+				}
+
+				return this->read(1, output);
+			}
+
+			bool read_uint32(unsigned int* output)
+			{
+				if (!this->read_data_type(8))
+				{
+					return false;
+				}
+
+				return this->read(32, output);
+			}
+
+			bool read_data_type(const char expected)
+			{
+				char data_type = 0;
+
+				if (!this->use_data_types_) return true;
+				if (this->read(5, &data_type))
+				{
+					return (data_type == expected);
+				}
+
+				return false;
+			}
+
+			bool write_bool(bool data)
+			{
+				if (this->write_data_type(1))
+				{
+					return this->write(1, &data);
+				}
+
+				return false;
+			}
+
+			bool write_int32(int data)
+			{
+				if (this->write_data_type(7))
+				{
+					return this->write(32, &data);
+				}
+
+				return false;
+			}
+
+			bool write_uint32(unsigned int data)
+			{
+				if (this->write_data_type(8))
+				{
+					return this->write(32, &data);
+				}
+
+				return false;
+			}
+
+			bool write_data_type(char data)
+			{
+				if (!this->use_data_types_)
+				{
+					return true;
+				}
+
+				return this->write(5, &data);
+			}
+
+			bool read(unsigned int bits, void* output)
+			{
+				if (bits == 0) return false;
+				if ((this->current_bit_ + bits) > (this->buffer_.size() * 8)) return false;
+
+				int cur_byte = this->current_bit_ >> 3;
+				auto cur_out = 0;
+
+				const char* bytes = this->buffer_.data();
+				const auto output_bytes = static_cast<unsigned char*>(output);
+
+				while (bits > 0)
+				{
+					const int min_bit = (bits < 8) ? bits : 8;
+					const auto this_byte = bytes[cur_byte++] & 0xFF;
+					const int remain = this->current_bit_ & 7;
+
+					if ((min_bit + remain) <= 8)
+					{
+						output_bytes[cur_out] = uint8_t((0xFF >> (8 - min_bit)) & (this_byte >> remain));
+					}
+					else
+					{
+						output_bytes[cur_out] = uint8_t(
+							((0xFF >> (8 - min_bit)) & (bytes[cur_byte] << (8 - remain))) | (this_byte >> remain));
+					}
+
+					cur_out++;
+					this->current_bit_ += min_bit;
+					bits -= min_bit;
+				}
+
+				return true;
+			}
+
+			bool write(const unsigned int bits, const void* data)
+			{
+				if (bits == 0) return false;
+				this->buffer_.resize(this->buffer_.size() + (bits >> 3) + 1);
+
+				int bit = bits;
+				const auto bytes = const_cast<char*>(this->buffer_.data());
+				const auto* input_bytes = static_cast<const unsigned char*>(data);
+
+				while (bit > 0)
+				{
+					const int bit_pos = this->current_bit_ & 7;
+					auto rem_bit = 8 - bit_pos;
+					const auto this_write = (bit < rem_bit) ? bit : rem_bit;
+
+					const uint8_t mask = ((0xFF >> rem_bit) | (0xFF << (bit_pos + this_write)));
+					const int byte_pos = this->current_bit_ >> 3;
+
+					const uint8_t temp_byte = (mask & bytes[byte_pos]);
+					const uint8_t this_bit = ((bits - bit) & 7);
+					const auto this_byte = (bits - bit) >> 3;
+
+					auto this_data = input_bytes[this_byte];
+
+					const auto next_byte = (((bits - 1) >> 3) > this_byte) ? input_bytes[this_byte + 1] : 0;
+
+					this_data = uint8_t((next_byte << (8 - this_bit)) | (this_data >> this_bit));
+
+					const uint8_t out_byte = ((~mask & (this_data << bit_pos)) | temp_byte);
+					bytes[byte_pos] = out_byte;
+
+					this->current_bit_ += this_write;
+					bit -= this_write;
+				}
+
+				return true;
+			}
+
+			void set_use_data_types(const bool use_data_types)
+			{
+				this->use_data_types_ = use_data_types;
+			}
+
+			unsigned int size() const
+			{
+				return this->current_bit_ / 8 + (this->current_bit_ % 8 ? 1 : 0);
+			}
+
+			std::string& get_buffer()
+			{
+				this->buffer_.resize(this->size());
+				return this->buffer_;
+			}
+
+		private:
+			std::string buffer_{};
+			unsigned int current_bit_ = 0;
+			bool use_data_types_ = true;
+		};
+
+		enum class operation
+		{
+			boolean,
+			int32,
+			uint32,
+			raw,
+			toggle_data_types,
+			count,
+		};
+
+		struct step
+		{
+			operation op;
+			unsigned int bits;
+			std::array<uint8_t, 16> data;
+		};
+
+		std::vector<step> make_steps(std::mt19937& random)
+		{
+			std::vector<step> steps(random() % 40);
+			for (auto& step : steps)
+			{
+				step.op = static_cast<operation>(random() % static_cast<uint32_t>(operation::count));
+				step.bits = 1 + random() % 128;
+
+				for (auto& byte : step.data)
+				{
+					byte = static_cast<uint8_t>(random());
+				}
+
+				if (step.op == operation::raw && step.bits % 8)
+				{
+					// Bits above the written length are never stored
+					step.data[step.bits / 8] &= static_cast<uint8_t>((1u << (step.bits % 8)) - 1);
+					std::fill(step.data.begin() + step.bits / 8 + 1, step.data.end(), uint8_t(0));
+				}
+			}
+
+			return steps;
+		}
+
+		template <typename Buffer>
+		std::string write_steps(const std::vector<step>& steps)
+		{
+			Buffer buffer;
+			auto use_data_types = true;
+
+			for (const auto& step : steps)
+			{
+				uint32_t value;
+				std::memcpy(&value, step.data.data(), sizeof(value));
+
+				switch (step.op)
+				{
+				case operation::boolean: buffer.write_bool(step.data[0] & 1); break;
+				case operation::int32: buffer.write_int32(static_cast<int>(value)); break;
+				case operation::uint32: buffer.write_uint32(value); break;
+				case operation::raw: buffer.write(step.bits, step.data.data()); break;
+				case operation::toggle_data_types:
+					use_data_types = !use_data_types;
+					buffer.set_use_data_types(use_data_types);
+					break;
+				case operation::count: break;
+				}
+			}
+
+			return buffer.get_buffer();
+		}
+
+		// Each read is recorded with its result and every output byte, untouched ones included
+		template <typename Buffer>
+		std::vector<std::string> read_steps(const std::string& data, const std::vector<step>& steps)
+		{
+			Buffer buffer(data);
+			auto use_data_types = true;
+			std::vector<std::string> results;
+
+			for (const auto& step : steps)
+			{
+				std::array<uint8_t, 20> output;
+				output.fill(0xCD);
+
+				bool result = false;
+				switch (step.op)
+				{
+				case operation::boolean: result = buffer.read_bool(reinterpret_cast<bool*>(output.data())); break;
+				case operation::int32: result = buffer.read_data_type(7) && buffer.read(32, output.data()); break;
+				case operation::uint32: result = buffer.read_uint32(reinterpret_cast<unsigned int*>(output.data())); break;
+				case operation::raw: result = buffer.read(step.bits, output.data()); break;
+				case operation::toggle_data_types:
+					use_data_types = !use_data_types;
+					buffer.set_use_data_types(use_data_types);
+					break;
+				case operation::count: break;
+				}
+
+				results.emplace_back(1, static_cast<char>(result));
+				results.back().append(reinterpret_cast<const char*>(output.data()), output.size());
+			}
+
+			return results;
+		}
+
+		// What reading back the written steps has to produce, as far as the value goes
+		bool matches_written(const std::vector<step>& steps, const std::vector<std::string>& results)
+		{
+			for (size_t i = 0; i < steps.size(); ++i)
+			{
+				const auto& step = steps[i];
+				const auto& result = results[i];
+
+				if (step.op == operation::toggle_data_types) continue;
+				if (!result[0]) return false;
+
+				const auto* output = result.data() + 1;
+				switch (step.op)
+				{
+				case operation::boolean:
+					if ((output[0] & 1) != (step.data[0] & 1)) return false;
+					break;
+				case operation::int32:
+				case operation::uint32:
+					if (std::memcmp(output, step.data.data(), 4)) return false;
+					break;
+				case operation::raw:
+					if (std::memcmp(output, step.data.data(), (step.bits + 7) / 8)) return false;
+					break;
+				default: break;
+				}
+			}
+
+			return true;
+		}
+
+		template <typename Buffer>
+		double time_messages(const std::vector<std::vector<step>>& messages, const size_t count, size_t* bytes)
+		{
+			*bytes = 0;
+			const auto start = clock::now();
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const auto& steps = messages[i % messages.size()];
+				const auto data = write_steps<Buffer>(steps);
+
+				Buffer buffer(data);
+				auto use_data_types = true;
+				std::array<uint8_t, 16> output{};
+
+				for (const auto& step : steps)
+				{
+					switch (step.op)
+					{
+					case operation::boolean: buffer.read_bool(reinterpret_cast<bool*>(output.data())); break;
+					case operation::int32: buffer.read_data_type(7) && buffer.read(32, output.data()); break;
+					case operation::uint32: buffer.read_uint32(reinterpret_cast<unsigned int*>(output.data())); break;
+					case operation::raw: buffer.read(step.bits, output.data()); break;
+					case operation::toggle_data_types:
+						use_data_types = !use_data_types;
+						buffer.set_use_data_types(use_data_types);
+						break;
+					case operation::count: break;
+					}
+				}
+
+				*bytes += data.size() + output[0];
+			}
+
+			return std::chrono::duration<double>(clock::now() - start).count();
+		}
+	}
+
+	bool run_bit_buffer_bench(const bit_buffer_bench_options& options)
+	{
+		std::mt19937 random(1337);
+
+		size_t bad_writes = 0;
+		size_t bad_reads = 0;
+		size_t bad_round_trips = 0;
+
+		for (size_t run = 0; run < options.runs; ++run)
+		{
+			const auto steps = make_steps(random);
+
+			const auto written = write_steps<demonware::bit_buffer>(steps);
+			if (written != write_steps<legacy_bit_buffer>(steps))
+			{
+				++bad_writes;
+				continue;
+			}
+
+			const auto results = read_steps<demonware::bit_buffer>(written, steps);
+			if (!matches_written(steps, results))
+			{
+				++bad_round_trips;
+			}
+
+			// Arbitrary reads over arbitrary data, including reads that run off the end
+			auto garbage = written;
+			for (auto& byte : garbage)
+			{
+				if (random() % 4 == 0) byte = static_cast<char>(random());
+			}
+
+			garbage.resize(random() % (garbage.size() + 1));
+			const auto read_plan = make_steps(random);
+
+			if (results != read_steps<legacy_bit_buffer>(written, steps)
+				|| read_steps<demonware::bit_buffer>(garbage, read_plan) != read_steps<legacy_bit_buffer>(garbage, read_plan))
+			{
+				++bad_reads;
+			}
+		}
+
+		printf("runs: %zu, differing writes: %zu, differing reads: %zu, failed round trips: %zu\n", options.runs,
+		       bad_writes, bad_reads, bad_round_trips);
+
+		std::vector<std::vector<step>> messages(256);
+		for (auto& message : messages)
+		{
+			message = make_steps(random);
+		}
+
+		size_t current_bytes, legacy_bytes;
+		const auto current = time_messages<demonware::bit_buffer>(messages, options.messages, &current_bytes);
+		const auto legacy = time_messages<legacy_bit_buffer>(messages, options.messages, &legacy_bytes);
+
+		printf("%zu messages (%zu bytes) written and read: %.3f s, previous implementation %.3f s (%.2fx)\n",
+		       options.messages, current_bytes, current, legacy, legacy / current);
+
+		return !bad_writes && !bad_reads && !bad_round_trips;
+	}
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace host
+{
+	struct bit_buffer_bench_options
+	{
+		size_t runs = 100000;
+		size_t messages = 200000;
+	};
+
+	// Runs random write and read sequences through bit_buffer and the
+	// previous byte-at-a-time implementation, checks that both produce the
+	// same bytes and read back the same values, then times both.
+	bool run_bit_buffer_bench(const bit_buffer_bench_options& options);
+}
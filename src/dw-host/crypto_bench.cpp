@@ -0,0 +1,160 @@
+#include <std_include.hpp>
+#include "crypto_bench.hpp"
+
+#include <utils/cryptography.hpp>
+
+namespace host
+{
+	namespace
+	{
+		using clock = std::chrono::steady_clock;
+
+		constexpr size_t block_size = 16;
+
+		struct message
+		{
+			std::string data;
+			std::string iv;
+		};
+
+		std::string random_bytes(std::mt19937& random, const size_t length)
+		{
+			std::string bytes(length, '\0');
+			for (auto& byte : bytes)
+			{
+				byte = static_cast<char>(random());
+			}
+
+			return bytes;
+		}
+
+		const uint8_t* bytes(const std::string& data)
+		{
+			return reinterpret_cast<const uint8_t*>(data.data());
+		}
+
+		template <typename Callback>
+		double time_messages(const std::vector<message>& messages, const size_t count, Callback callback)
+		{
+			size_t checksum = 0;
+
+			const auto start = clock::now();
+			for (size_t i = 0; i < count; ++i)
+			{
+				checksum += callback(messages[i % messages.size()]);
+			}
+
+			const auto seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+			// Keeps the compiler from dropping the work
+			if (checksum == static_cast<size_t>(-1))
+			{
+				printf("checksum: %zu\n", checksum);
+			}
+
+			return seconds;
+		}
+
+		void print_timing(const char* name, const size_t count, const double keyed, const double per_message)
+		{
+			printf("%-8s keyed context %.3f s (%.0f ns/message), per-message setup %.3f s (%.0f ns/message) (%.2fx)\n",
+			       name, keyed, keyed * 1e9 / static_cast<double>(count), per_message,
+			       per_message * 1e9 / static_cast<double>(count), per_message / keyed);
+		}
+	}
+
+	bool run_crypto_bench(const crypto_bench_options& options)
+	{
+		namespace crypto = utils::cryptography;
+
+		std::mt19937 random(1337);
+
+		// Same key sizes as the session keys, messages are padded to whole blocks like replies
+		const auto aes_key = random_bytes(random, 16);
+		const auto hmac_key = random_bytes(random, crypto::hmac_sha1::digest_size);
+		const auto size = std::max<size_t>((options.size + block_size - 1) & ~(block_size - 1), block_size);
+
+		std::vector<message> messages(64);
+		for (auto& entry : messages)
+		{
+			entry.data = random_bytes(random, size);
+			entry.iv = random_bytes(random, block_size);
+		}
+
+		crypto::aes::context encrypt_context(aes_key);
+		crypto::aes::context decrypt_context(aes_key);
+		const crypto::hmac_sha1::context hmac_context(hmac_key);
+
+		if (!encrypt_context.is_valid() || !decrypt_context.is_valid() || !hmac_context.is_valid())
+		{
+			printf("Failed to set up the keyed contexts\n");
+			return false;
+		}
+
+		size_t bad_encrypts = 0;
+		size_t bad_decrypts = 0;
+		size_t bad_hmacs = 0;
+
+		std::string output(size, '\0');
+		uint8_t digest[crypto::hmac_sha1::digest_size];
+
+		for (const auto& entry : messages)
+		{
+			const auto encrypted = crypto::aes::encrypt(entry.data, entry.iv, aes_key);
+			encrypt_context.encrypt(bytes(entry.data), size, bytes(entry.iv), reinterpret_cast<uint8_t*>(output.data()));
+			bad_encrypts += output != encrypted;
+
+			decrypt_context.decrypt(bytes(encrypted), size, bytes(entry.iv), reinterpret_cast<uint8_t*>(output.data()));
+			bad_decrypts += output != crypto::aes::decrypt(encrypted, entry.iv, aes_key) || output != entry.data;
+
+			hmac_context.compute(bytes(entry.data), size, digest);
+			bad_hmacs += std::string(reinterpret_cast<const char*>(digest), sizeof(digest)) !=
+				crypto::hmac_sha1::compute(entry.data, hmac_key);
+		}
+
+		printf("messages: %zu of %zu bytes, differing encrypts: %zu, differing decrypts: %zu, differing hmacs: %zu\n",
+		       messages.size(), size, bad_encrypts, bad_decrypts, bad_hmacs);
+
+		auto* out = reinterpret_cast<uint8_t*>(output.data());
+
+		const auto keyed_encrypt = time_messages(messages, options.messages, [&](const message& entry)
+		{
+			encrypt_context.encrypt(bytes(entry.data), size, bytes(entry.iv), out);
+			return static_cast<size_t>(out[0]);
+		});
+
+		const auto encrypt = time_messages(messages, options.messages, [&](const message& entry)
+		{
+			return static_cast<size_t>(crypto::aes::encrypt(entry.data, entry.iv, aes_key)[0]);
+		});
+
+		const auto keyed_decrypt = time_messages(messages, options.messages, [&](const message& entry)
+		{
+			decrypt_context.decrypt(bytes(entry.data), size, bytes(entry.iv), out);
+			return static_cast<size_t>(out[0]);
+		});
+
+		const auto decrypt = time_messages(messages, options.messages, [&](const message& entry)
+		{
+			return static_cast<size_t>(crypto::aes::decrypt(entry.data, entry.iv, aes_key)[0]);
+		});
+
+		const auto keyed_hmac = time_messages(messages, options.messages, [&](const message& entry)
+		{
+			hmac_context.compute(bytes(entry.data), size, digest);
+			return static_cast<size_t>(digest[0]);
+		});
+
+		const auto hmac = time_messages(messages, options.messages, [&](const message& entry)
+		{
+			return static_cast<size_t>(crypto::hmac_sha1::compute(entry.data, hmac_key)[0]);
+		});
+
+		printf("%zu messages of %zu bytes:\n", options.messages, size);
+		print_timing("encrypt", options.messages, keyed_encrypt, encrypt);
+		print_timing("decrypt", options.messages, keyed_decrypt, decrypt);
+		print_timing("hmac", options.messages, keyed_hmac, hmac);
+
+		return !bad_encrypts && !bad_decrypts && !bad_hmacs;
+	}
+}
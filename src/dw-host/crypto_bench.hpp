@@ -0,0 +1,15 @@
+#pragma once
+
+namespace host
+{
+	struct crypto_bench_options
+	{
+		size_t messages = 200000;
+		size_t size = 1024;
+	};
+
+	// Encrypts, decrypts and signs messages with the keyed aes and hmac_sha1
+	// contexts and with the per-message functions that set the key up on every
+	// call, checks that both produce the same bytes, then times both.
+	bool run_crypto_bench(const crypto_bench_options& options);
+}
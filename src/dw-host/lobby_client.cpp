@@ -0,0 +1,266 @@
+#include <std_include.hpp>
+#include "lobby_client.hpp"
+
+#include "game/demonware/byte_buffer.hpp"
+
+#include <utils/cryptography.hpp>
+
+namespace host
+{
+	namespace
+	{
+		std::string random_bytes(const size_t size)
+		{
+			std::string data(size, '\0');
+			utils::cryptography::random::get_data(data.data(), data.size());
+			return data;
+		}
+
+		std::string authenticate(const std::string& address, const uint16_t port, const size_t client)
+		{
+			std::string token(128, '\0');
+			const auto username = "bench_" + std::to_string(client);
+			std::memcpy(token.data() + 64, username.data(), std::min(username.size(), size_t(63)));
+
+			rapidjson::StringBuffer extra_data_buffer{};
+			rapidjson::Writer<rapidjson::StringBuffer> extra_data(extra_data_buffer);
+			extra_data.StartObject();
+			extra_data.Key("token");
+			extra_data.String(utils::cryptography::base64::encode(
+				reinterpret_cast<const unsigned char*>(token.data()), token.size()).data());
+			extra_data.EndObject();
+
+			rapidjson::StringBuffer body_buffer{};
+			rapidjson::Writer<rapidjson::StringBuffer> body(body_buffer);
+			body.StartObject();
+			body.Key("title_id");
+			body.String("9450");
+			body.Key("iv_seed");
+			body.String(std::to_string(client + 1).data());
+			body.Key("extra_data");
+			body.String(extra_data_buffer.GetString(), static_cast<rapidjson::SizeType>(extra_data_buffer.GetSize()));
+			body.EndObject();
+
+			std::string request;
+			request.append("POST /auth/ HTTP/1.1\r\n");
+			request.append("Host: aw-pc-auth3.prod.demonware.net\r\n");
+			request.append("Content-Type: application/json\r\n");
+			request.append("Content-Length: " + std::to_string(body_buffer.GetSize()) + "\r\n\r\n");
+			request.append(body_buffer.GetString(), body_buffer.GetSize());
+
+			const connection auth(address, static_cast<uint16_t>(port + 1));
+			auth.send(request);
+
+			const auto response = auth.receive_http();
+
+			rapidjson::Document document;
+			document.Parse(response.data(), response.size());
+
+			if (!document.IsObject() || !document.HasMember("server_ticket") || !document["server_ticket"].IsString())
+			{
+				throw std::runtime_error("Invalid auth response");
+			}
+
+			// The server ticket starts with the session key
+			const auto& server_ticket = document["server_ticket"];
+			const auto ticket = utils::cryptography::base64::decode(
+				std::string(server_ticket.GetString(), server_ticket.GetStringLength()));
+
+			if (ticket.size() < 24)
+			{
+				throw std::runtime_error("Invalid server ticket");
+			}
+
+			return ticket.substr(0, 24);
+		}
+	}
+
+	connection::connection(const std::string& address, const uint16_t port)
+	{
+		this->socket_ = ::socket(AF_INET, SOCK_STREAM, 0);
+		if (this->socket_ < 0)
+		{
+			throw std::runtime_error("Failed to create socket");
+		}
+
+		constexpr int enable = 1;
+		setsockopt(this->socket_, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+		sockaddr_in target{};
+		target.sin_family = AF_INET;
+		target.sin_port = htons(port);
+
+		if (inet_pton(AF_INET, address.data(), &target.sin_addr) != 1
+			|| connect(this->socket_, reinterpret_cast<sockaddr*>(&target), sizeof(target)) < 0)
+		{
+			close(this->socket_);
+			throw std::runtime_error("Failed to connect to " + address + ":" + std::to_string(port));
+		}
+	}
+
+	connection::~connection()
+	{
+		close(this->socket_);
+	}
+
+	void connection::send(const std::string_view data) const
+	{
+		size_t offset = 0;
+		while (offset < data.size())
+		{
+			const auto sent = ::send(this->socket_, data.data() + offset, data.size() - offset, MSG_NOSIGNAL);
+			if (sent <= 0)
+			{
+				throw std::runtime_error("Connection lost while sending");
+			}
+
+			offset += static_cast<size_t>(sent);
+		}
+	}
+
+	std::string connection::receive(const size_t size) const
+	{
+		std::string data(size, '\0');
+
+		size_t offset = 0;
+		while (offset < size)
+		{
+			const auto received = recv(this->socket_, data.data() + offset, size - offset, 0);
+			if (received <= 0)
+			{
+				throw std::runtime_error("Connection lost while receiving");
+			}
+
+			offset += static_cast<size_t>(received);
+		}
+
+		return data;
+	}
+
+	std::string connection::receive_frame() const
+	{
+		int size;
+		const auto header = this->receive(sizeof(size));
+		std::memcpy(&size, header.data(), sizeof(size));
+
+		if (size < 0)
+		{
+			throw std::runtime_error("Invalid frame size");
+		}
+
+		return header + this->receive(static_cast<size_t>(size));
+	}
+
+	std::string connection::receive_http() const
+	{
+		std::string response;
+		size_t header_end;
+
+		while ((header_end = response.find("\r\n\r\n")) == std::string::npos)
+		{
+			response.append(this->receive(1));
+		}
+
+		const auto length_header = response.find("Content-Length: ");
+		if (length_header == std::string::npos || length_header > header_end)
+		{
+			throw std::runtime_error("Missing content length");
+		}
+
+		const auto length = std::stoul(response.substr(length_header + 16));
+		return this->receive(length);
+	}
+
+	lobby_client::lobby_client(const std::string& address, const uint16_t port, const size_t client)
+		: lobby_(address, port)
+	{
+		this->handshake(authenticate(address, port, client));
+	}
+
+	void lobby_client::handshake(const std::string& session_key)
+	{
+		demonware::byte_buffer header;
+		header.set_use_data_types(false);
+		header.write_int32(0xC8);
+		header.write_int32(0xC8);
+		header.write(random_bytes(32));
+
+		this->lobby_.send(header.get_buffer());
+		this->keys_.queue_packet_to_hash(std::string_view(header.get_buffer()).substr(8));
+		this->keys_.queue_packet_to_hash(this->lobby_.receive_frame());
+
+		demonware::byte_buffer auth;
+		auth.set_use_data_types(false);
+		auth.write_int32(0);
+		auth.write_byte(static_cast<char>(0xAB));
+		auth.write_byte(static_cast<char>(0x82));
+		auth.write(random_bytes(16));
+		auth.write(std::string(8, '\0'));
+
+		auto& auth_packet = auth.get_buffer();
+		const auto auth_size = static_cast<int>(auth_packet.size() - 4);
+		std::memcpy(auth_packet.data(), &auth_size, sizeof(auth_size));
+
+		this->keys_.queue_packet_to_hash(std::string_view(auth_packet).substr(0, auth_packet.size() - 8));
+		this->keys_.derive_keys_s1(session_key);
+
+		this->lobby_.send(auth_packet);
+
+		const auto auth_done = this->lobby_.receive_frame();
+		if (auth_done.size() != 14 || auth_done.substr(6) != this->keys_.get_response_id())
+		{
+			throw std::runtime_error("Lobby handshake failed");
+		}
+	}
+
+	std::string lobby_client::build_call(const uint8_t service, const std::string_view payload)
+	{
+		demonware::byte_buffer buffer;
+		buffer.set_use_data_types(false);
+		buffer.write_uint32(0);
+		buffer.write_byte(static_cast<char>(0x86));
+		buffer.write_byte(static_cast<char>(service));
+		buffer.write(static_cast<int>(payload.size()), payload.data());
+
+		auto& data = buffer.get_buffer();
+		const auto data_size = static_cast<uint32_t>(data.size() - 4);
+		std::memcpy(data.data(), &data_size, sizeof(data_size));
+		data.resize(~15 & (data.size() + 15));
+
+		const auto seed = random_bytes(16);
+
+		demonware::byte_buffer packet;
+		packet.set_use_data_types(false);
+		packet.write_int32(0);
+		packet.write_byte(static_cast<char>(0xAB));
+		packet.write_byte(static_cast<char>(0x85));
+		packet.write_uint32(++this->msg_count_);
+		packet.write(seed);
+
+		// The server decrypts with its decrypt key, so that is what we encrypt with
+		auto& result = packet.get_buffer();
+		const auto header_size = result.size();
+		result.resize(header_size + data.size());
+
+		if (!this->keys_.get_decrypt_context().encrypt(reinterpret_cast<const uint8_t*>(data.data()), data.size(),
+		                                               reinterpret_cast<const uint8_t*>(seed.data()),
+		                                               reinterpret_cast<uint8_t*>(result.data()) + header_size))
+		{
+			throw std::runtime_error("Failed to encrypt service call");
+		}
+
+		// The lobby does not verify the trailing hash
+		result.append(8, '\0');
+
+		const auto size = static_cast<int>(result.size() - 4);
+		std::memcpy(result.data(), &size, sizeof(size));
+
+		return result;
+	}
+
+	task_reply lobby_client::exchange(const std::string_view packet)
+	{
+		this->lobby_.send(packet);
+		return decode_task_reply(this->keys_, this->lobby_.receive_frame());
+	}
+}
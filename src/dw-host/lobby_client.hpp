@@ -0,0 +1,50 @@
+#pragma once
+
+#include "reply_decoder.hpp"
+
+#include "game/demonware/keys.hpp"
+
+namespace host
+{
+	class connection final
+	{
+	public:
+		connection(const std::string& address, uint16_t port);
+		~connection();
+
+		connection(connection&&) = delete;
+		connection(const connection&) = delete;
+		connection& operator=(connection&&) = delete;
+		connection& operator=(const connection&) = delete;
+
+		void send(std::string_view data) const;
+		std::string receive(size_t size) const;
+
+		// Every lobby message starts with the size of what follows
+		std::string receive_frame() const;
+		std::string receive_http() const;
+
+	private:
+		SOCKET socket_;
+	};
+
+	// A logged in lobby connection, the way the game sets one up
+	class lobby_client final
+	{
+	public:
+		lobby_client(const std::string& address, uint16_t port, size_t client);
+
+		// Encrypts a service call. The payload starts with the typed task id.
+		std::string build_call(uint8_t service, std::string_view payload);
+
+		// Sends an encrypted call and waits for its reply
+		task_reply exchange(std::string_view packet);
+
+	private:
+		connection lobby_;
+		demonware::session_keys keys_;
+		uint32_t msg_count_ = 0;
+
+		void handshake(const std::string& session_key);
+	};
+}
@@ -0,0 +1,180 @@
+#include <std_include.hpp>
+#include "bench_client.hpp"
+#include "bit_buffer_bench.hpp"
+#include "crypto_bench.hpp"
+#include "replay_client.hpp"
+#include "resources.hpp"
+#include "stats_bench.hpp"
+#include "storage_bench.hpp"
+#include "socket_host.hpp"
+
+#include "game/demonware/servers/auth3_server.hpp"
+#include "game/demonware/servers/lobby_server.hpp"
+#include "game/demonware/servers/stun_server.hpp"
+#include "game/demonware/user_storage.hpp"
+
+namespace
+{
+	std::atomic_bool stop_requested{false};
+
+	void print_usage()
+	{
+		printf("usage: dw-host serve [--port 3074] [--resources src/client/resources/dw]\n");
+		printf("       dw-host bench [--address 127.0.0.1] [--port 3074] [--clients 16] [--requests 1000]\n");
+		printf("       dw-host replay --trace <file> [--address 127.0.0.1] [--port 3074] [--clients 1] [--paced]\n");
+		printf("       dw-host stats [--file stats_bench.dat] [--rows 1000000] [--queries 100000]\n");
+		printf("       dw-host bits [--runs 100000] [--messages 200000]\n");
+		printf("       dw-host storage [--dir storage_bench] [--threads 8] [--writes 20000] [--files 256] [--cache-kb 64]\n");
+		printf("       dw-host crypto [--messages 200000] [--size 1024]\n");
+		printf("\n");
+		printf("The lobby listens on tcp <port>, auth3 on tcp <port + 1> and stun on udp <port>.\n");
+	}
+
+	std::optional<std::string> get_option(const std::vector<std::string>& args, const std::string& name)
+	{
+		const auto entry = std::find(args.begin(), args.end(), name);
+		if (entry == args.end() || std::next(entry) == args.end())
+		{
+			return {};
+		}
+
+		return *std::next(entry);
+	}
+
+	int serve(const std::vector<std::string>& args)
+	{
+		const auto port = static_cast<uint16_t>(std::stoul(get_option(args, "--port").value_or("3074")));
+		const auto resources = get_option(args, "--resources").value_or("src/client/resources/dw");
+
+		if (!host::resources::load(resources))
+		{
+			return 1;
+		}
+
+		host::socket_host host;
+
+		host.listen_tcp(port, []
+		{
+			return std::make_unique<demonware::lobby_server>("aw-pc-lobby.prod.demonware.net");
+		});
+
+		host.listen_tcp(static_cast<uint16_t>(port + 1), []
+		{
+			return std::make_unique<demonware::auth3_server>("aw-pc-auth3.prod.demonware.net");
+		});
+
+		host.listen_udp(port, std::make_unique<demonware::stun_server>("stun.us.demonware.net"));
+
+		signal(SIGINT, [](int)
+		{
+			stop_requested = true;
+		});
+
+		signal(SIGTERM, [](int)
+		{
+			stop_requested = true;
+		});
+
+		printf("Serving demonware on port %u\n", port);
+		host.run(stop_requested);
+
+		demonware::user_storage::shutdown();
+		return 0;
+	}
+
+	int bench(const std::vector<std::string>& args)
+	{
+		host::bench_options options{};
+		options.address = get_option(args, "--address").value_or(options.address);
+		options.port = static_cast<uint16_t>(std::stoul(get_option(args, "--port").value_or("3074")));
+		options.clients = std::stoul(get_option(args, "--clients").value_or("16"));
+		options.requests = std::stoul(get_option(args, "--requests").value_or("1000"));
+
+		return host::run_bench(options) ? 0 : 1;
+	}
+
+	int replay(const std::vector<std::string>& args)
+	{
+		host::replay_options options{};
+		options.trace = get_option(args, "--trace").value_or("");
+		options.address = get_option(args, "--address").value_or(options.address);
+		options.port = static_cast<uint16_t>(std::stoul(get_option(args, "--port").value_or("3074")));
+		options.clients = std::stoul(get_option(args, "--clients").value_or("1"));
+		options.paced = std::find(args.begin(), args.end(), "--paced") != args.end();
+
+		if (options.trace.empty())
+		{
+			print_usage();
+			return 1;
+		}
+
+		return host::run_replay(options) ? 0 : 1;
+	}
+
+	int stats(const std::vector<std::string>& args)
+	{
+		host::stats_bench_options options{};
+		options.file = get_option(args, "--file").value_or(options.file);
+		options.rows = std::stoul(get_option(args, "--rows").value_or("1000000"));
+		options.queries = std::stoul(get_option(args, "--queries").value_or("100000"));
+
+		return host::run_stats_bench(options) ? 0 : 1;
+	}
+
+	int bits(const std::vector<std::string>& args)
+	{
+		host::bit_buffer_bench_options options{};
+		options.runs = std::stoul(get_option(args, "--runs").value_or("100000"));
+		options.messages = std::stoul(get_option(args, "--messages").value_or("200000"));
+
+		return host::run_bit_buffer_bench(options) ? 0 : 1;
+	}
+
+	int storage(const std::vector<std::string>& args)
+	{
+		host::storage_bench_options options{};
+		options.directory = get_option(args, "--dir").value_or(options.directory);
+		options.threads = std::stoul(get_option(args, "--threads").value_or("8"));
+		options.writes = std::stoul(get_option(args, "--writes").value_or("20000"));
+		options.files = std::stoul(get_option(args, "--files").value_or("256"));
+		options.cache_kb = std::stoul(get_option(args, "--cache-kb").value_or("64"));
+
+		const auto result = host::run_storage_bench(options);
+		demonware::user_storage::shutdown();
+		return result ? 0 : 1;
+	}
+
+	int crypto(const std::vector<std::string>& args)
+	{
+		host::crypto_bench_options options{};
+		options.messages = std::stoul(get_option(args, "--messages").value_or("200000"));
+		options.size = std::stoul(get_option(args, "--size").value_or("1024"));
+
+		return host::run_crypto_bench(options) ? 0 : 1;
+	}
+}
+
+int main(const int argc, char** argv)
+{
+	const std::vector<std::string> args(argv + std::min(argc, 2), argv + argc);
+	const std::string mode = argc > 1 ? argv[1] : "";
+
+	try
+	{
+		if (mode == "serve") return serve(args);
+		if (mode == "bench") return bench(args);
+		if (mode == "replay") return replay(args);
+		if (mode == "stats") return stats(args);
+		if (mode == "bits") return bits(args);
+		if (mode == "storage") return storage(args);
+		if (mode == "crypto") return crypto(args);
+	}
+	catch (const std::exception& e)
+	{
+		printf("Error: %s\n", e.what());
+		return 1;
+	}
+
+	print_usage();
+	return 1;
+}
@@ -0,0 +1,135 @@
+#include <std_include.hpp>
+#include "replay_client.hpp"
+#include "lobby_client.hpp"
+
+#include "game/demonware/trace.hpp"
+
+namespace host
+{
+	namespace
+	{
+		using clock = std::chrono::steady_clock;
+
+		struct task_stats
+		{
+			size_t calls = 0;
+			size_t error_replies = 0;
+			uint64_t recorded = 0;
+			std::chrono::nanoseconds replayed{};
+		};
+
+		struct client_result
+		{
+			std::map<uint16_t, task_stats> tasks;
+			std::string failure;
+		};
+
+		void run_client(const replay_options& options, const std::vector<demonware::trace::call>& calls,
+		                const size_t client, client_result& result)
+		{
+			try
+			{
+				lobby_client lobby(options.address, options.port, client);
+				const auto start = clock::now();
+
+				for (const auto& call : calls)
+				{
+					const auto packet = lobby.build_call(call.service, call.payload);
+
+					if (options.paced)
+					{
+						std::this_thread::sleep_until(start + std::chrono::nanoseconds(call.timestamp));
+					}
+
+					const auto call_start = clock::now();
+					const auto reply = lobby.exchange(packet);
+					const auto latency = clock::now() - call_start;
+
+					auto& stats = result.tasks[static_cast<uint16_t>((call.service << 8) | call.task)];
+					++stats.calls;
+					stats.recorded += call.latency;
+					stats.replayed += latency;
+
+					if (reply.error)
+					{
+						++stats.error_replies;
+					}
+				}
+			}
+			catch (const std::exception& e)
+			{
+				result.failure = e.what();
+			}
+		}
+	}
+
+	bool run_replay(const replay_options& options)
+	{
+		const auto calls = demonware::trace::load(options.trace);
+		if (calls.empty())
+		{
+			printf("trace %s holds no calls\n", options.trace.data());
+			return false;
+		}
+
+		std::vector<client_result> results(options.clients);
+		std::vector<std::thread> threads;
+		threads.reserve(options.clients);
+
+		const auto start = clock::now();
+
+		for (size_t i = 0; i < options.clients; ++i)
+		{
+			threads.emplace_back(run_client, std::cref(options), std::cref(calls), i, std::ref(results[i]));
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		const auto elapsed = std::chrono::duration<double>(clock::now() - start).count();
+
+		std::map<uint16_t, task_stats> tasks;
+		size_t total_calls = 0;
+		size_t error_replies = 0;
+		size_t failed_clients = 0;
+
+		for (const auto& result : results)
+		{
+			if (!result.failure.empty())
+			{
+				++failed_clients;
+				printf("client failed: %s\n", result.failure.data());
+			}
+
+			for (const auto& [key, stats] : result.tasks)
+			{
+				auto& total = tasks[key];
+				total.calls += stats.calls;
+				total.error_replies += stats.error_replies;
+				total.recorded += stats.recorded;
+				total.replayed += stats.replayed;
+
+				total_calls += stats.calls;
+				error_replies += stats.error_replies;
+			}
+		}
+
+		printf("trace: %zu calls, clients: %zu (%zu failed), replayed: %zu, error replies: %zu\n", calls.size(),
+		       options.clients, failed_clients, total_calls, error_replies);
+		printf("elapsed: %.3f s, throughput: %.0f req/s\n", elapsed, static_cast<double>(total_calls) / elapsed);
+		printf("%-8s %-5s %10s %10s %16s %16s\n", "service", "task", "calls", "errors", "recorded us",
+		       "round trip us");
+
+		for (const auto& [key, stats] : tasks)
+		{
+			const auto calls_count = static_cast<double>(std::max(stats.calls, size_t(1)));
+			printf("%-8u %-5u %10zu %10zu %16.1f %16.1f\n", key >> 8, key & 0xFF, stats.calls, stats.error_replies,
+			       static_cast<double>(stats.recorded) / 1000.0 / calls_count,
+			       std::chrono::duration<double, std::micro>(stats.replayed).count() / calls_count);
+		}
+
+		return failed_clients == 0;
+	}
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+namespace host
+{
+	struct replay_options
+	{
+		std::string trace;
+		std::string address = "127.0.0.1";
+		uint16_t port = 3074;
+		size_t clients = 1;
+		bool paced = false;
+	};
+
+	// Sends the service calls from a recorded trace to a running host, optionally
+	// keeping the recorded spacing, and compares replayed against recorded latency.
+	bool run_replay(const replay_options& options);
+}
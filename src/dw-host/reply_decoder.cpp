@@ -0,0 +1,54 @@
+#include <std_include.hpp>
+#include "reply_decoder.hpp"
+
+#include "game/demonware/byte_reader.hpp"
+
+namespace host
+{
+	task_reply decode_task_reply(demonware::session_keys& keys, const std::string& frame)
+	{
+		constexpr size_t header_size = 26;
+		constexpr size_t hash_size = 8;
+
+		if (frame.size() < header_size + hash_size || static_cast<uint8_t>(frame[5]) != 0x85)
+		{
+			throw std::runtime_error("Unexpected reply");
+		}
+
+		std::string data(frame.size() - header_size - hash_size, '\0');
+		if (!keys.get_encrypt_context().decrypt(reinterpret_cast<const uint8_t*>(frame.data()) + header_size,
+		                                        data.size(), reinterpret_cast<const uint8_t*>(frame.data()) + 10,
+		                                        reinterpret_cast<uint8_t*>(data.data())))
+		{
+			throw std::runtime_error("Failed to decrypt reply");
+		}
+
+		demonware::byte_reader reader(data);
+		reader.set_use_data_types(false);
+
+		uint32_t size;
+		uint8_t type;
+		if (!reader.read_uint32(&size) || !reader.read_byte(&type) || size > reader.remaining())
+		{
+			throw std::runtime_error("Malformed reply");
+		}
+
+		// Drop the padding the cipher needed
+		demonware::byte_reader service_data(reader.get_remaining().substr(0, size));
+
+		task_reply reply{};
+		if (!service_data.read_uint64(&reply.transaction_id)
+			|| !service_data.read_uint32(&reply.error)
+			|| !service_data.read_byte(&reply.task))
+		{
+			throw std::runtime_error("Malformed reply");
+		}
+
+		if (!reply.error)
+		{
+			reply.results = std::string(service_data.get_remaining());
+		}
+
+		return reply;
+	}
+}
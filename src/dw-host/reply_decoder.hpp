@@ -0,0 +1,19 @@
+#pragma once
+
+#include "game/demonware/keys.hpp"
+
+namespace host
+{
+	struct task_reply
+	{
+		uint64_t transaction_id;
+		uint32_t error;
+		uint8_t task;
+
+		// Typed service data following the header, empty for errors
+		std::string results;
+	};
+
+	// Decrypts an encrypted lobby frame and splits off the service reply header
+	task_reply decode_task_reply(demonware::session_keys& keys, const std::string& frame);
+}
@@ -0,0 +1,63 @@
+#include <std_include.hpp>
+#include "resources.hpp"
+
+#include "game/demonware/platform.hpp"
+
+#include <utils/io.hpp>
+
+namespace host::resources
+{
+	namespace
+	{
+		// Mirrors the DW_* entries of the client's resource.rc
+		const std::pair<int, const char*> resource_files[] =
+		{
+			{DW_ENTITLEMENT_CONFIG, "entitlement_config.info"},
+			{DW_SOCIAL_CONFIG, "social_tu22.cfg"},
+			{DW_MM_CONFIG, "mm.cfg"},
+			{DW_LOOT_CONFIG, "lootConfig_tu22.csv"},
+			{DW_STORE_CONFIG, "winStoreConfig_tu22.csv"},
+			{DW_MOTD, "motd-english.txt"},
+			{DW_FASTFILE, "ffotd-1.22.1.ff"},
+			{DW_PLAYLISTS, "playlists_tu22.aggr"},
+		};
+
+		std::unordered_map<int, std::string> loaded_resources;
+	}
+
+	bool load(const std::string& directory)
+	{
+		for (const auto& [id, file] : resource_files)
+		{
+			std::string data;
+			if (!utils::io::read_file(directory + "/" + file, &data))
+			{
+				printf("Failed to load resource %s from %s\n", file, directory.data());
+				return false;
+			}
+
+			loaded_resources[id] = std::move(data);
+		}
+
+		return true;
+	}
+}
+
+namespace demonware::platform
+{
+	std::string load_resource(const int id)
+	{
+		const auto entry = host::resources::loaded_resources.find(id);
+		if (entry == host::resources::loaded_resources.end())
+		{
+			return {};
+		}
+
+		return entry->second;
+	}
+
+	std::string get_motd()
+	{
+		return load_resource(DW_MOTD);
+	}
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+namespace host::resources
+{
+	// Loads the publisher files the client embeds as RCDATA from disk instead
+	bool load(const std::string& directory);
+}
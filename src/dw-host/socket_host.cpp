@@ -0,0 +1,253 @@
+#include <std_include.hpp>
+#include "socket_host.hpp"
+
+namespace host
+{
+	namespace
+	{
+		constexpr size_t io_buffer_size = 0x10000;
+
+		bool would_block()
+		{
+			return errno == EAGAIN || errno == EWOULDBLOCK;
+		}
+
+		void set_non_blocking(const SOCKET socket)
+		{
+			const auto flags = fcntl(socket, F_GETFL, 0);
+			if (flags < 0 || fcntl(socket, F_SETFL, flags | O_NONBLOCK) < 0)
+			{
+				throw std::runtime_error("Failed to make socket non-blocking");
+			}
+		}
+
+		SOCKET bind_socket(const int type, const uint16_t port)
+		{
+			const SOCKET socket = ::socket(AF_INET, type, 0);
+			if (socket < 0)
+			{
+				throw std::runtime_error("Failed to create socket");
+			}
+
+			auto _ = gsl::finally([&]()
+			{
+				if (socket >= 0) close(socket);
+			});
+
+			constexpr int enable = 1;
+			setsockopt(socket, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+			sockaddr_in address{};
+			address.sin_family = AF_INET;
+			address.sin_addr.s_addr = htonl(INADDR_ANY);
+			address.sin_port = htons(port);
+
+			if (bind(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0)
+			{
+				throw std::runtime_error("Failed to bind port " + std::to_string(port));
+			}
+
+			set_non_blocking(socket);
+
+			_.dismiss();
+			return socket;
+		}
+	}
+
+	socket_host::~socket_host()
+	{
+		for (const auto& listener : this->listeners_) close(listener.socket);
+		for (const auto& connection : this->connections_) close(connection.socket);
+		for (const auto& socket : this->datagram_sockets_) close(socket.socket);
+	}
+
+	void socket_host::listen_tcp(const uint16_t port, tcp_factory factory)
+	{
+		const auto socket = bind_socket(SOCK_STREAM, port);
+		if (listen(socket, SOMAXCONN) < 0)
+		{
+			close(socket);
+			throw std::runtime_error("Failed to listen on port " + std::to_string(port));
+		}
+
+		this->listeners_.push_back({socket, std::move(factory)});
+	}
+
+	void socket_host::listen_udp(const uint16_t port, std::unique_ptr<demonware::udp_server> server)
+	{
+		const auto socket = bind_socket(SOCK_DGRAM, port);
+		this->datagram_sockets_.push_back({socket, std::move(server)});
+	}
+
+	void socket_host::run(const std::atomic_bool& stop)
+	{
+		std::vector<pollfd> fds;
+
+		while (!stop)
+		{
+			fds.clear();
+
+			for (const auto& listener : this->listeners_)
+			{
+				fds.push_back({listener.socket, POLLIN, 0});
+			}
+
+			for (const auto& socket : this->datagram_sockets_)
+			{
+				const auto pending = socket.server->pending_data(socket.socket);
+				fds.push_back({socket.socket, static_cast<short>(POLLIN | (pending ? POLLOUT : 0)), 0});
+			}
+
+			for (const auto& connection : this->connections_)
+			{
+				fds.push_back({connection.socket, static_cast<short>(POLLIN | (connection.out.empty() ? 0 : POLLOUT)), 0});
+			}
+
+			const auto result = poll(fds.data(), fds.size(), 100);
+			if (result < 0 && errno != EINTR)
+			{
+				throw std::runtime_error("poll failed");
+			}
+
+			if (result <= 0)
+			{
+				continue;
+			}
+
+			auto* event = fds.data();
+
+			// Accepted connections are appended, so the indices below stay valid
+			const auto polled_connections = this->connections_.size();
+
+			for (const auto& listener : this->listeners_)
+			{
+				if ((event++)->revents & POLLIN)
+				{
+					this->accept_connections(listener);
+				}
+			}
+
+			for (const auto& socket : this->datagram_sockets_)
+			{
+				this->service_datagrams(socket, (event++)->revents);
+			}
+
+			for (size_t i = 0; i < polled_connections; ++i)
+			{
+				auto& connection = this->connections_[i];
+				if (!this->service_connection(connection, (event++)->revents))
+				{
+					close(connection.socket);
+					connection.socket = -1;
+				}
+			}
+
+			std::erase_if(this->connections_, [](const connection& connection)
+			{
+				return connection.socket < 0;
+			});
+		}
+	}
+
+	void socket_host::accept_connections(const listener& listener)
+	{
+		while (true)
+		{
+			const SOCKET socket = accept(listener.socket, nullptr, nullptr);
+			if (socket < 0)
+			{
+				return;
+			}
+
+			// Replies are small and latency is what gets measured
+			constexpr int enable = 1;
+			setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+			set_non_blocking(socket);
+
+			this->connections_.push_back({socket, listener.factory(), {}});
+		}
+	}
+
+	bool socket_host::service_connection(connection& connection, const short events)
+	{
+		if (events & (POLLERR | POLLNVAL))
+		{
+			return false;
+		}
+
+		char buffer[io_buffer_size];
+
+		if (events & (POLLIN | POLLHUP))
+		{
+			const auto size = recv(connection.socket, buffer, sizeof(buffer), 0);
+			if (size == 0 || (size < 0 && !would_block()))
+			{
+				return false;
+			}
+
+			if (size > 0)
+			{
+				connection.server->handle_input(buffer, static_cast<size_t>(size));
+				connection.server->frame();
+
+				while (connection.server->pending_data())
+				{
+					const auto length = connection.server->handle_output(buffer, sizeof(buffer));
+					connection.out.append(buffer, length);
+				}
+			}
+		}
+
+		if (!connection.out.empty())
+		{
+			const auto sent = send(connection.socket, connection.out.data(), connection.out.size(), MSG_NOSIGNAL);
+			if (sent < 0)
+			{
+				return would_block();
+			}
+
+			connection.out.erase(0, static_cast<size_t>(sent));
+		}
+
+		return true;
+	}
+
+	void socket_host::service_datagrams(const datagram_socket& socket, const short events)
+	{
+		char buffer[io_buffer_size];
+
+		if (events & POLLIN)
+		{
+			while (true)
+			{
+				sockaddr_in address{};
+				socklen_t length = sizeof(address);
+
+				const auto size = recvfrom(socket.socket, buffer, sizeof(buffer), 0,
+				                           reinterpret_cast<sockaddr*>(&address), &length);
+				if (size < 0)
+				{
+					break;
+				}
+
+				const demonware::udp_server::endpoint_data endpoint(socket.socket, reinterpret_cast<sockaddr*>(&address),
+				                                                    static_cast<int>(length));
+				socket.server->handle_input(buffer, static_cast<size_t>(size), endpoint);
+			}
+
+			socket.server->frame();
+		}
+
+		while (socket.server->pending_data(socket.socket))
+		{
+			sockaddr_in address{};
+			auto length = static_cast<int>(sizeof(address));
+
+			const auto size = socket.server->handle_output(socket.socket, buffer, sizeof(buffer),
+			                                               reinterpret_cast<sockaddr*>(&address), &length);
+			// Datagrams are best effort, a full send buffer just drops them
+			sendto(socket.socket, buffer, size, MSG_NOSIGNAL, reinterpret_cast<sockaddr*>(&address),
+			       static_cast<socklen_t>(length));
+		}
+	}
+}
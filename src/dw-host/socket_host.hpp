@@ -0,0 +1,56 @@
+#pragma once
+
+#include "game/demonware/servers/tcp_server.hpp"
+#include "game/demonware/servers/udp_server.hpp"
+
+namespace host
+{
+	// Drives the demonware servers from real sockets. Every TCP connection
+	// gets its own server instance, so sessions never share key state.
+	class socket_host final
+	{
+	public:
+		using tcp_factory = std::function<std::unique_ptr<demonware::tcp_server>()>;
+
+		socket_host() = default;
+		~socket_host();
+
+		socket_host(socket_host&&) = delete;
+		socket_host(const socket_host&) = delete;
+		socket_host& operator=(socket_host&&) = delete;
+		socket_host& operator=(const socket_host&) = delete;
+
+		void listen_tcp(uint16_t port, tcp_factory factory);
+		void listen_udp(uint16_t port, std::unique_ptr<demonware::udp_server> server);
+
+		void run(const std::atomic_bool& stop);
+
+	private:
+		struct listener
+		{
+			SOCKET socket;
+			tcp_factory factory;
+		};
+
+		struct connection
+		{
+			SOCKET socket;
+			std::unique_ptr<demonware::tcp_server> server;
+			std::string out;
+		};
+
+		struct datagram_socket
+		{
+			SOCKET socket;
+			std::unique_ptr<demonware::udp_server> server;
+		};
+
+		std::vector<listener> listeners_;
+		std::vector<connection> connections_;
+		std::vector<datagram_socket> datagram_sockets_;
+
+		void accept_connections(const listener& listener);
+		bool service_connection(connection& connection, short events);
+		void service_datagrams(const datagram_socket& socket, short events);
+	};
+}
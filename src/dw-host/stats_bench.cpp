@@ -0,0 +1,195 @@
+#include <std_include.hpp>
+#include "stats_bench.hpp"
+
+#include "game/demonware/stats_store.hpp"
+
+#include <utils/io.hpp>
+
+namespace host
+{
+	namespace
+	{
+		using clock = std::chrono::steady_clock;
+
+		constexpr uint32_t leaderboard_id = 1;
+		constexpr size_t write_batch_size = 100;
+
+		double to_seconds(const clock::duration duration)
+		{
+			return std::chrono::duration<double>(duration).count();
+		}
+
+		double to_microseconds(const clock::duration duration)
+		{
+			return std::chrono::duration<double, std::micro>(duration).count();
+		}
+
+		template <typename F>
+		void time_queries(const char* name, const size_t queries, F&& query)
+		{
+			std::vector<clock::duration> latencies;
+			latencies.reserve(queries);
+
+			for (size_t i = 0; i < queries; ++i)
+			{
+				const auto start = clock::now();
+				query(i);
+				latencies.push_back(clock::now() - start);
+			}
+
+			std::sort(latencies.begin(), latencies.end());
+
+			const auto percentile = [&](const double p)
+			{
+				return to_microseconds(latencies[static_cast<size_t>(p * static_cast<double>(latencies.size() - 1))]);
+			};
+
+			printf("%-10s p50 %.2f us, p99 %.2f us, max %.2f us\n", name, percentile(0.5), percentile(0.99),
+			       percentile(1.0));
+		}
+
+		// Threads overwrite the same few rows, a reload has to end up where memory did
+		bool check_concurrent_writes(const std::string& file)
+		{
+			constexpr uint32_t concurrent_leaderboard_id = 2;
+			constexpr uint64_t entities = 16;
+			constexpr size_t threads = 8;
+			constexpr size_t writes = 5000;
+
+			utils::io::remove_file(file);
+
+			std::vector<uint64_t> entity_ids;
+			for (uint64_t entity_id = 1; entity_id <= entities; ++entity_id)
+			{
+				entity_ids.push_back(entity_id);
+			}
+
+			std::vector<demonware::stats_store::ranked_row> in_memory;
+
+			{
+				demonware::stats_store store(file);
+
+				std::vector<std::thread> writers;
+				for (size_t thread = 0; thread < threads; ++thread)
+				{
+					writers.emplace_back([&store, thread]
+					{
+						for (size_t i = 0; i < writes; ++i)
+						{
+							const auto rating = static_cast<int64_t>(thread * writes + i);
+							store.write({{concurrent_leaderboard_id, 1 + i % entities, rating, std::to_string(rating)}});
+						}
+					});
+				}
+
+				for (auto& writer : writers)
+				{
+					writer.join();
+				}
+
+				in_memory = store.read_by_entities(concurrent_leaderboard_id, entity_ids);
+			}
+
+			demonware::stats_store reloaded(file);
+			const auto on_disk = reloaded.read_by_entities(concurrent_leaderboard_id, entity_ids);
+
+			size_t differing = in_memory.size() != on_disk.size() ? entities : 0;
+			for (size_t i = 0; !differing && i < in_memory.size(); ++i)
+			{
+				differing += in_memory[i].value.rating != on_disk[i].value.rating
+					|| in_memory[i].value.data != on_disk[i].value.data;
+			}
+
+			printf("concurrent writes: %zu threads, %zu of %llu rows differ after reload\n", threads, differing,
+			       static_cast<unsigned long long>(entities));
+
+			utils::io::remove_file(file);
+			return !differing;
+		}
+	}
+
+	bool run_stats_bench(const stats_bench_options& options)
+	{
+		if (!options.rows || !options.queries)
+		{
+			printf("rows and queries must not be zero\n");
+			return false;
+		}
+
+		utils::io::remove_file(options.file);
+
+		std::mt19937_64 random(1337);
+		const auto rating_of = [](const uint64_t entity_id)
+		{
+			return static_cast<int64_t>((entity_id * 0x9E3779B97F4A7C15ull) >> 44);
+		};
+
+		{
+			demonware::stats_store store(options.file);
+
+			const auto write_start = clock::now();
+
+			std::vector<demonware::stats_store::row> batch;
+			batch.reserve(write_batch_size);
+
+			for (uint64_t entity_id = 1; entity_id <= options.rows; ++entity_id)
+			{
+				batch.push_back({leaderboard_id, entity_id, rating_of(entity_id), std::string(16, 'k')});
+				if (batch.size() == write_batch_size || entity_id == options.rows)
+				{
+					store.write(batch);
+					batch.clear();
+				}
+			}
+
+			const auto write_end = clock::now();
+			store.flush();
+			const auto flush_end = clock::now();
+
+			printf("write: %zu rows in %.2f s (%.0f rows/s), final sync %.2f s\n", options.rows,
+			       to_seconds(write_end - write_start),
+			       static_cast<double>(options.rows) / to_seconds(write_end - write_start),
+			       to_seconds(flush_end - write_end));
+		}
+
+		const auto load_start = clock::now();
+		demonware::stats_store store(options.file);
+		const auto load_end = clock::now();
+
+		if (store.size(leaderboard_id) != options.rows)
+		{
+			printf("reload lost rows: %zu of %zu\n", store.size(leaderboard_id), options.rows);
+			return false;
+		}
+
+		printf("reload: %.2f s, log %zu bytes\n", to_seconds(load_end - load_start), utils::io::file_size(options.file));
+
+		auto failures = 0;
+
+		time_queries("rank", options.queries, [&](size_t)
+		{
+			const auto entity_id = 1 + random() % options.rows;
+			const auto rows = store.read_by_entities(leaderboard_id, {entity_id});
+			if (rows.size() != 1 || rows[0].value.rating != rating_of(entity_id)) ++failures;
+		});
+
+		time_queries("top-100", options.queries, [&](const size_t i)
+		{
+			const auto first_rank = 1 + (i % 10) * 100;
+			const auto rows = store.read_by_rank(leaderboard_id, first_rank, 100);
+			if (rows.size() != 100 || rows.front().rank != first_rank) ++failures;
+		});
+
+		time_queries("around-me", options.queries, [&](size_t)
+		{
+			const auto entity_id = 1 + random() % options.rows;
+			const auto rows = store.read_around(leaderboard_id, entity_id, 21);
+			if (rows.size() != std::min(options.rows, size_t(21))) ++failures;
+		});
+
+		printf("failed queries: %d\n", failures);
+
+		utils::io::remove_file(options.file);
+		return check_concurrent_writes(options.file) && failures == 0;
+	}
+}
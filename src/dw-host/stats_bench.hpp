@@ -0,0 +1,16 @@
+#pragma once
+
+namespace host
+{
+	struct stats_bench_options
+	{
+		std::string file = "stats_bench.dat";
+		size_t rows = 1000000;
+		size_t queries = 100000;
+	};
+
+	// Loads synthetic rows into a fresh stats_store, then times the sync,
+	// a reload from the log and rank, top-N and around-me reads. Also checks
+	// that concurrent writers leave the log in the order memory saw.
+	bool run_stats_bench(const stats_bench_options& options);
+}
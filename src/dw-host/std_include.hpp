@@ -0,0 +1,53 @@
+#pragma once
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <csignal>
+
+#include <map>
+#include <array>
+#include <bit>
+#include <bitset>
+#include <atomic>
+#include <vector>
+#include <mutex>
+#include <shared_mutex>
+#include <queue>
+#include <list>
+#include <chrono>
+#include <thread>
+#include <fstream>
+#include <iostream>
+#include <utility>
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <sstream>
+#include <optional>
+#include <random>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+#include <condition_variable>
+#include <cstring>
+#include <ctime>
+
+#include <gsl/gsl>
+#include <tomcrypt.h>
+
+#include <rapidjson/document.h>
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+#include "resource.hpp"
+
+// The demonware servers are written against Winsock handles
+using SOCKET = int;
+
+using namespace std::literals;
@@ -0,0 +1,200 @@
+#include <std_include.hpp>
+#include "storage_bench.hpp"
+
+#include "game/demonware/user_storage.hpp"
+
+#include <utils/io.hpp>
+
+namespace host
+{
+	namespace
+	{
+		using clock = std::chrono::steady_clock;
+
+		struct expected_file
+		{
+			std::mutex mutex;
+			std::string contents;
+			bool written = false;
+		};
+
+		std::string make_contents(std::mt19937& random, const size_t thread, const size_t write)
+		{
+			auto contents = std::to_string(thread) + ":" + std::to_string(write) + ":";
+			contents.append(random() % 2048, static_cast<char>('a' + random() % 26));
+			return contents;
+		}
+
+		// Flushes while other threads keep writing, a flush only has to cover what was
+		// written before it and must not wait for the writers to stop
+		bool check_flush_under_writes(const storage_bench_options& options,
+		                              const std::function<std::string(size_t)>& path_of)
+		{
+			constexpr size_t flushes = 50;
+			constexpr auto flush_limit = std::chrono::seconds(5);
+
+			std::atomic_bool stop{false};
+			const auto deadline = clock::now() + std::chrono::seconds(60);
+
+			std::vector<std::thread> writers;
+			for (size_t thread = 0; thread < options.threads; ++thread)
+			{
+				writers.emplace_back([&, thread]
+				{
+					std::mt19937 random(static_cast<uint32_t>(7331 + thread));
+
+					for (size_t write = 0; !stop && clock::now() < deadline; ++write)
+					{
+						demonware::user_storage::write(path_of(random() % options.files),
+						                               make_contents(random, thread, write));
+					}
+				});
+			}
+
+			const auto marker_path = options.directory + "/flush_marker";
+
+			size_t bad_markers = 0;
+			auto slowest = clock::duration::zero();
+
+			for (size_t flush = 0; flush < flushes; ++flush)
+			{
+				const auto marker = "flush:" + std::to_string(flush);
+				demonware::user_storage::write(marker_path, marker);
+
+				const auto start = clock::now();
+				demonware::user_storage::flush();
+				slowest = std::max(slowest, clock::now() - start);
+
+				std::string disk;
+				if (!utils::io::read_file(marker_path, &disk) || disk != marker)
+				{
+					++bad_markers;
+				}
+			}
+
+			stop = true;
+			for (auto& writer : writers)
+			{
+				writer.join();
+			}
+
+			demonware::user_storage::flush();
+
+			printf("flushes under writes: %zu, slowest %.3f s, marker missing from disk: %zu\n", flushes,
+			       std::chrono::duration<double>(slowest).count(), bad_markers);
+
+			return !bad_markers && slowest < flush_limit;
+		}
+	}
+
+	bool run_storage_bench(const storage_bench_options& options)
+	{
+		if (!options.threads || !options.files)
+		{
+			printf("threads and files must not be zero\n");
+			return false;
+		}
+
+		std::error_code ec;
+		std::filesystem::remove_all(options.directory, ec);
+
+		demonware::user_storage::set_cache_limit(options.cache_kb * 1024);
+
+		const std::function<std::string(size_t)> path_of = [&](const size_t file)
+		{
+			return options.directory + "/user_" + std::to_string(file);
+		};
+
+		std::vector<expected_file> expected(options.files);
+		std::atomic_size_t stale_reads{0};
+
+		const auto start = clock::now();
+
+		std::vector<std::thread> threads;
+		for (size_t thread = 0; thread < options.threads; ++thread)
+		{
+			threads.emplace_back([&, thread]
+			{
+				std::mt19937 random(static_cast<uint32_t>(1337 + thread));
+
+				for (size_t write = 0; write < options.writes; ++write)
+				{
+					// Hot files take most writes, the rest push them out of the cache
+					const auto index = random() % 4 ? random() % 8 % options.files : random() % options.files;
+					auto& file = expected[index];
+
+					std::lock_guard<std::mutex> _(file.mutex);
+
+					if (random() % 4 == 0)
+					{
+						const auto data = demonware::user_storage::read(path_of(index));
+						if (file.written && (!data || *data != file.contents))
+						{
+							++stale_reads;
+						}
+
+						continue;
+					}
+
+					file.contents = make_contents(random, thread, write);
+					file.written = true;
+					demonware::user_storage::write(path_of(index), file.contents);
+
+					if (thread == 0 && write % 1000 == 0)
+					{
+						demonware::user_storage::flush();
+					}
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		demonware::user_storage::flush();
+		const auto duration = std::chrono::duration<double>(clock::now() - start).count();
+
+		size_t written_files = 0;
+		size_t bad_disk = 0;
+		size_t bad_cache = 0;
+
+		for (size_t index = 0; index < options.files; ++index)
+		{
+			const auto& file = expected[index];
+			if (!file.written)
+			{
+				continue;
+			}
+
+			++written_files;
+
+			std::string disk;
+			if (!utils::io::read_file(path_of(index), &disk) || disk != file.contents)
+			{
+				++bad_disk;
+			}
+
+			const auto cached = demonware::user_storage::read(path_of(index));
+			if (!cached || *cached != file.contents)
+			{
+				++bad_cache;
+			}
+		}
+
+		const auto stats = demonware::user_storage::get_cache_stats();
+		const auto within_limit = stats.bytes <= options.cache_kb * 1024;
+
+		printf("%zu threads, %zu operations in %.2f s\n", options.threads, options.threads * options.writes, duration);
+		printf("files written: %zu, disk writes: %llu\n", written_files,
+		       static_cast<unsigned long long>(stats.disk_writes));
+		printf("cache: %zu files, %zu bytes of %zu allowed\n", stats.files, stats.bytes, options.cache_kb * 1024);
+		printf("stale reads: %zu, wrong on disk: %zu, wrong in cache: %zu\n", stale_reads.load(), bad_disk,
+		       bad_cache);
+
+		const auto flushed_under_writes = check_flush_under_writes(options, path_of);
+
+		return !stale_reads && !bad_disk && !bad_cache && within_limit && flushed_under_writes;
+	}
+}
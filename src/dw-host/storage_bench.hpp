@@ -0,0 +1,19 @@
+#pragma once
+
+namespace host
+{
+	struct storage_bench_options
+	{
+		std::string directory = "storage_bench";
+		size_t threads = 8;
+		size_t writes = 20000;
+		size_t files = 256;
+		size_t cache_kb = 64;
+	};
+
+	// Hammers user_storage with concurrent writes, reads and flushes over a
+	// cache too small for every file, then checks that the cache and the
+	// disk both hold the last contents written to each file. Then flushes while
+	// writers keep going and checks each flush returns with its writes on disk.
+	bool run_storage_bench(const storage_bench_options& options);
+}
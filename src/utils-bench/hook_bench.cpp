@@ -0,0 +1,277 @@
+#include <std_include.hpp>
+#include "hook_bench.hpp"
+
+#include <utils/hook_transaction.hpp>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace bench
+{
+	namespace
+	{
+		using clock = std::chrono::steady_clock;
+
+		// Forwards to the real backend while counting what the transaction asked for
+		class counting_protection final : public utils::hook::page_protection
+		{
+		public:
+			size_t unprotected = 0;
+			size_t restored = 0;
+			size_t flushed = 0;
+
+			size_t get_page_size() override
+			{
+				return get_default().get_page_size();
+			}
+
+			bool unprotect(void* page, uint32_t* old_protection) override
+			{
+				++this->unprotected;
+				return get_default().unprotect(page, old_protection);
+			}
+
+			void restore(void* page, const uint32_t old_protection) override
+			{
+				++this->restored;
+				get_default().restore(page, old_protection);
+			}
+
+			void flush_instruction_cache(void* start, const size_t length) override
+			{
+				++this->flushed;
+				get_default().flush_instruction_cache(start, length);
+			}
+		};
+
+		struct patch
+		{
+			size_t offset;
+			int kind;
+			uint64_t value;
+			size_t length;
+		};
+
+		std::vector<patch> build_patches(const size_t count, const size_t size, std::mt19937_64& random)
+		{
+			std::uniform_int_distribution<int> kind_distribution(0, 3);
+			std::uniform_int_distribution<size_t> length_distribution(1, 16);
+
+			std::vector<patch> patches;
+			patches.reserve(count);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				patch entry{};
+				entry.kind = kind_distribution(random);
+				entry.value = random();
+				entry.length = entry.kind == 1 ? length_distribution(random) : entry.kind == 0 ? 8 : 5;
+				entry.offset = std::uniform_int_distribution<size_t>(0, size - entry.length)(random);
+				patches.push_back(entry);
+			}
+
+			return patches;
+		}
+
+		void record(utils::hook::transaction& transaction, uint8_t* base, const patch& entry)
+		{
+			auto* place = base + entry.offset;
+
+			switch (entry.kind)
+			{
+			case 0:
+				transaction.set<uint64_t>(place, entry.value);
+				break;
+			case 1:
+				transaction.nop(place, entry.length);
+				break;
+			case 2:
+				transaction.call(place, base + (entry.value % 0x1000));
+				break;
+			default:
+				transaction.jump(place, base + (entry.value % 0x1000));
+				break;
+			}
+		}
+
+		bool is_read_execute(const uint8_t* base, const size_t size)
+		{
+			std::ifstream maps("/proc/self/maps");
+			const auto start = reinterpret_cast<uintptr_t>(base);
+			const auto end = start + size;
+
+			size_t covered = 0;
+			std::string line;
+			while (std::getline(maps, line))
+			{
+				unsigned long long map_start{}, map_end{};
+				char permissions[5]{};
+
+				if (sscanf(line.data(), "%llx-%llx %4s", &map_start, &map_end, permissions) != 3
+					|| map_end <= start || map_start >= end)
+				{
+					continue;
+				}
+
+				if (std::string_view(permissions, 3) != "r-x")
+				{
+					return false;
+				}
+
+				covered += std::min<uintptr_t>(map_end, end) - std::max<uintptr_t>(map_start, start);
+			}
+
+			return covered == size;
+		}
+
+		// Plain heap memory is already writable, used to build the expected image
+		class writable_memory final : public utils::hook::page_protection
+		{
+		public:
+			size_t get_page_size() override
+			{
+				return get_default().get_page_size();
+			}
+
+			bool unprotect(void*, uint32_t* old_protection) override
+			{
+				*old_protection = 0;
+				return true;
+			}
+
+			void restore(void*, uint32_t) override
+			{
+			}
+
+			void flush_instruction_cache(void*, size_t) override
+			{
+			}
+		};
+
+		double to_microseconds(const clock::duration duration)
+		{
+			return std::chrono::duration<double, std::micro>(duration).count();
+		}
+	}
+
+	bool run_hook_bench(const hook_bench_options& options)
+	{
+		const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+		const auto size = options.pages * page_size;
+
+		auto* base = static_cast<uint8_t*>(mmap(nullptr, size + page_size, PROT_READ | PROT_WRITE,
+		                                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+		if (base == MAP_FAILED)
+		{
+			printf("failed to map %zu pages\n", options.pages);
+			return false;
+		}
+
+		std::mt19937_64 random(0x40);
+		for (size_t i = 0; i < size; ++i)
+		{
+			base[i] = static_cast<uint8_t>(random());
+		}
+
+		// The page after the image is left unmapped for the failure check
+		munmap(base + size, page_size);
+		mprotect(base, size, PROT_READ | PROT_EXEC);
+
+		const auto patches = build_patches(options.patches, size, random);
+
+		// Expected contents, written in the same order
+		std::vector<uint8_t> expected(base, base + size);
+		std::set<size_t> touched_pages;
+		bool expected_committed;
+		{
+			writable_memory memory;
+			utils::hook::transaction transaction(memory);
+			for (const auto& entry : patches)
+			{
+				record(transaction, expected.data(), entry);
+
+				const auto last_page = (entry.offset + entry.length - 1) / page_size;
+				for (auto page = entry.offset / page_size; page <= last_page; ++page)
+				{
+					touched_pages.insert(page);
+				}
+			}
+
+			expected_committed = transaction.commit();
+		}
+
+		counting_protection counting;
+		bool batch_committed;
+		const auto batch_start = clock::now();
+		{
+			utils::hook::transaction transaction(counting);
+			for (const auto& entry : patches)
+			{
+				record(transaction, base, entry);
+			}
+
+			batch_committed = transaction.commit();
+		}
+		const auto batch_time = clock::now() - batch_start;
+
+		const auto batch_written = expected_committed && batch_committed
+			&& std::memcmp(base, expected.data(), size) == 0;
+		const auto batch_protected = is_read_execute(base, size);
+		const auto batch_counts = counting.unprotected == touched_pages.size()
+			&& counting.restored == touched_pages.size() && counting.flushed == 1;
+
+		printf("batched: %.1f us for %zu patches, %zu of %zu pages unprotected, %zu restored, %zu flushes\n",
+		       to_microseconds(batch_time), patches.size(), counting.unprotected, options.pages, counting.restored,
+		       counting.flushed);
+
+		auto single_committed = true;
+		const auto single_start = clock::now();
+		for (const auto& entry : patches)
+		{
+			utils::hook::transaction transaction;
+			record(transaction, base, entry);
+			single_committed &= transaction.commit();
+		}
+		const auto single_time = clock::now() - single_start;
+
+		const auto single_written = single_committed && std::memcmp(base, expected.data(), size) == 0;
+		const auto single_protected = is_read_execute(base, size);
+
+		printf("one per patch: %.1f us for %zu patches (%.1fx)\n", to_microseconds(single_time), patches.size(),
+		       to_microseconds(single_time) / std::max(to_microseconds(batch_time), 1.0));
+
+		// A page that can't be unprotected has to keep the whole transaction from being written
+		const auto before = base[0];
+		bool rejected;
+		{
+			utils::hook::transaction transaction;
+			transaction.set<uint8_t>(base, static_cast<uint8_t>(~before));
+			transaction.set<uint8_t>(base + size, 0);
+			rejected = !transaction.commit() && base[0] == before && is_read_execute(base, size);
+		}
+
+		// A transaction left by an exception while recording must not write what it has so far
+		auto abandoned = false;
+		try
+		{
+			utils::hook::transaction transaction;
+			transaction.set<uint8_t>(base, static_cast<uint8_t>(~before));
+			transaction.call(base + 1, reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(base) ^ (1ull << 40)));
+		}
+		catch (const std::runtime_error&)
+		{
+			abandoned = base[0] == before;
+		}
+
+		printf("contents %s, protection %s, page counts %s, unmapped page %s, abandoned transaction %s\n",
+		       batch_written && single_written ? "match" : "DIFFER",
+		       batch_protected && single_protected ? "restored" : "NOT RESTORED",
+		       batch_counts ? "match" : "DIFFER",
+		       rejected ? "rejected" : "NOT REJECTED",
+		       abandoned ? "dropped" : "NOT DROPPED");
+
+		munmap(base, size);
+		return batch_written && single_written && batch_protected && single_protected && batch_counts && rejected
+			&& abandoned;
+	}
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace bench
+{
+	struct hook_bench_options
+	{
+		size_t pages = 64;
+		size_t patches = 1000;
+	};
+
+	// Patches read-only executable pages through hook transactions, checks the
+	// written bytes, protection changes and restored protection, and times one
+	// transaction per patch against a single batched transaction.
+	bool run_hook_bench(const hook_bench_options& options);
+}
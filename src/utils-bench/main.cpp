@@ -0,0 +1,74 @@
+#include <std_include.hpp>
+#include "signature_bench.hpp"
+#include "hook_bench.hpp"
+
+namespace
+{
+	void print_usage()
+	{
+		printf("usage: utils-bench signatures [--size-mb 64] [--patterns 500] [--baseline 16]\n");
+		printf("       utils-bench signature-cache [--file signature_bench.cache] [--size-mb 64] [--patterns 500]\n");
+		printf("       utils-bench hooks [--pages 64] [--patches 1000]\n");
+	}
+
+	std::optional<std::string> get_option(const std::vector<std::string>& args, const std::string& name)
+	{
+		const auto entry = std::find(args.begin(), args.end(), name);
+		if (entry == args.end() || std::next(entry) == args.end())
+		{
+			return {};
+		}
+
+		return *std::next(entry);
+	}
+
+	int signatures(const std::vector<std::string>& args)
+	{
+		bench::signature_bench_options options{};
+		options.image_size = std::stoul(get_option(args, "--size-mb").value_or("64")) * 1024 * 1024;
+		options.patterns = std::stoul(get_option(args, "--patterns").value_or("500"));
+		options.baseline = std::stoul(get_option(args, "--baseline").value_or("16"));
+
+		return bench::run_signature_bench(options) ? 0 : 1;
+	}
+
+	int signature_cache(const std::vector<std::string>& args)
+	{
+		bench::signature_cache_bench_options options{};
+		options.file = get_option(args, "--file").value_or(options.file);
+		options.image_size = std::stoul(get_option(args, "--size-mb").value_or("64")) * 1024 * 1024;
+		options.patterns = std::stoul(get_option(args, "--patterns").value_or("500"));
+
+		return bench::run_signature_cache_bench(options) ? 0 : 1;
+	}
+
+	int hooks(const std::vector<std::string>& args)
+	{
+		bench::hook_bench_options options{};
+		options.pages = std::stoul(get_option(args, "--pages").value_or("64"));
+		options.patches = std::stoul(get_option(args, "--patches").value_or("1000"));
+
+		return bench::run_hook_bench(options) ? 0 : 1;
+	}
+}
+
+int main(const int argc, char** argv)
+{
+	const std::vector<std::string> args(argv + std::min(argc, 2), argv + argc);
+	const std::string mode = argc > 1 ? argv[1] : "";
+
+	try
+	{
+		if (mode == "signatures") return signatures(args);
+		if (mode == "signature-cache") return signature_cache(args);
+		if (mode == "hooks") return hooks(args);
+	}
+	catch (const std::exception& e)
+	{
+		printf("Error: %s\n", e.what());
+		return 1;
+	}
+
+	print_usage();
+	return 1;
+}
@@ -0,0 +1,237 @@
+#include <std_include.hpp>
+#include "signature_bench.hpp"
+
+#include <utils/signature_cache.hpp>
+#include <utils/io.hpp>
+
+namespace bench
+{
+	namespace
+	{
+		using clock = std::chrono::steady_clock;
+
+		// Skewed towards the bytes that dominate x64 code, so anchors see realistic collisions
+		std::vector<uint8_t> build_image(const size_t size, std::mt19937_64& random)
+		{
+			std::array<double, 256> weights{};
+			weights.fill(1.0);
+			weights[0x00] = 40.0;
+			weights[0xCC] = 8.0;
+			weights[0x48] = 16.0;
+			weights[0x8B] = 12.0;
+			weights[0x89] = 8.0;
+			weights[0xFF] = 8.0;
+			weights[0xE8] = 5.0;
+			weights[0x0F] = 5.0;
+
+			std::discrete_distribution<int> distribution(weights.begin(), weights.end());
+
+			std::vector<uint8_t> image(size);
+			for (auto& byte : image)
+			{
+				byte = static_cast<uint8_t>(distribution(random));
+			}
+
+			return image;
+		}
+
+		std::string build_pattern(const std::vector<uint8_t>& image, std::mt19937_64& random)
+		{
+			std::uniform_int_distribution<size_t> length_distribution(10, 32);
+			const auto length = length_distribution(random);
+
+			std::uniform_int_distribution<size_t> offset_distribution(0, image.size() - length);
+			const auto offset = offset_distribution(random);
+
+			std::bernoulli_distribution wildcard(0.2);
+
+			std::string pattern;
+			for (size_t i = 0; i < length; ++i)
+			{
+				if (!pattern.empty())
+				{
+					pattern.push_back(' ');
+				}
+
+				if (i > 0 && wildcard(random))
+				{
+					pattern.push_back('?');
+					continue;
+				}
+
+				char byte[3];
+				snprintf(byte, sizeof(byte), "%02X", image[offset + i]);
+				pattern.append(byte, 2);
+			}
+
+			return pattern;
+		}
+
+		double to_milliseconds(const clock::duration duration)
+		{
+			return std::chrono::duration<double, std::milli>(duration).count();
+		}
+
+		bool same_results(const std::vector<utils::hook::signature::signature_result>& a,
+		                  const std::vector<utils::hook::signature::signature_result>& b)
+		{
+			if (a.size() != b.size())
+			{
+				return false;
+			}
+
+			for (size_t i = 0; i < a.size(); ++i)
+			{
+				if (a[i].count() != b[i].count())
+				{
+					return false;
+				}
+
+				for (size_t j = 0; j < a[i].count(); ++j)
+				{
+					if (a[i].get(j) != b[i].get(j))
+					{
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+	}
+
+	bool run_signature_bench(const signature_bench_options& options)
+	{
+		std::mt19937_64 random(0x5158);
+
+		printf("building %zu MiB image and %zu patterns\n", options.image_size >> 20, options.patterns);
+
+		// The single pattern scanner reads up to 16 bytes past the last offset
+		auto image = build_image(options.image_size, random);
+		const auto scan_size = image.size();
+		image.resize(image.size() + 16);
+
+		std::vector<std::string> patterns;
+		patterns.reserve(options.patterns);
+		for (size_t i = 0; i < options.patterns; ++i)
+		{
+			patterns.emplace_back(build_pattern(image, random));
+		}
+
+		utils::hook::signature_batch batch(image.data(), scan_size);
+		for (const auto& pattern : patterns)
+		{
+			batch.add(pattern);
+		}
+
+		const auto batch_start = clock::now();
+		const auto results = batch.process();
+		const auto batch_time = clock::now() - batch_start;
+
+		size_t matches = 0;
+		size_t unresolved = 0;
+		for (const auto& result : results)
+		{
+			matches += result.count();
+			unresolved += result.count() == 0;
+		}
+
+		const auto baseline = std::min(options.baseline, patterns.size());
+		size_t mismatches = 0;
+
+		const auto baseline_start = clock::now();
+		for (size_t i = 0; i < baseline; ++i)
+		{
+			const auto expected = utils::hook::signature(patterns[i], image.data(), scan_size).process();
+
+			auto same = expected.count() == results[i].count();
+			for (size_t j = 0; same && j < expected.count(); ++j)
+			{
+				same = expected.get(j) == results[i].get(j);
+			}
+
+			mismatches += !same;
+		}
+		const auto baseline_time = clock::now() - baseline_start;
+
+		const auto per_pattern = baseline ? to_milliseconds(baseline_time) / static_cast<double>(baseline) : 0.0;
+		const auto gigabytes = static_cast<double>(scan_size) / (1024.0 * 1024.0 * 1024.0);
+
+		printf("batch: %.1f ms for %zu patterns (%.2f GiB/s), %zu matches, %zu unresolved\n",
+		       to_milliseconds(batch_time), patterns.size(),
+		       gigabytes / std::chrono::duration<double>(batch_time).count(), matches, unresolved);
+		printf("single: %.1f ms per pattern, ~%.1f ms for all %zu patterns\n", per_pattern,
+		       per_pattern * static_cast<double>(patterns.size()), patterns.size());
+		printf("checked %zu patterns against single scans: %zu mismatches\n", baseline, mismatches);
+
+		return unresolved == 0 && mismatches == 0;
+	}
+
+	bool run_signature_cache_bench(const signature_cache_bench_options& options)
+	{
+		std::mt19937_64 random(0x5158);
+
+		auto image = build_image(options.image_size, random);
+
+		std::vector<std::string> patterns;
+		patterns.reserve(options.patterns);
+		for (size_t i = 0; i < options.patterns; ++i)
+		{
+			patterns.emplace_back(build_pattern(image, random));
+		}
+
+		utils::io::remove_file(options.file);
+
+		const auto run = [&](const std::function<void(utils::hook::signature_cache&)>& before_process = {})
+		{
+			utils::hook::signature_cache cache(options.file, image.data(), image.size());
+			for (const auto& pattern : patterns)
+			{
+				cache.add(pattern);
+			}
+
+			if (before_process)
+			{
+				before_process(cache);
+			}
+
+			const auto start = clock::now();
+			auto results = cache.process();
+			const auto elapsed = clock::now() - start;
+
+			return std::make_tuple(std::move(results), cache.get_scanned(), elapsed);
+		};
+
+		const auto [cold, cold_scanned, cold_time] = run();
+		printf("cold: %.1f ms, scanned %zu of %zu patterns\n", to_milliseconds(cold_time), cold_scanned,
+		       patterns.size());
+
+		const auto [warm, warm_scanned, warm_time] = run();
+		printf("warm: %.1f ms, scanned %zu of %zu patterns\n", to_milliseconds(warm_time), warm_scanned,
+		       patterns.size());
+
+		// Change the image behind the cache's back, the stale entry has to be caught by validation
+		const auto stale_offset = cold[0].get(0) - image.data();
+		const auto original = image[stale_offset];
+
+		const auto [stale, stale_scanned, stale_time] = run([&](const utils::hook::signature_cache& cache)
+		{
+			cache.get_image_hash();
+			image[stale_offset] = static_cast<uint8_t>(~original);
+		});
+
+		image[stale_offset] = original;
+
+		printf("stale: %.1f ms, scanned %zu of %zu patterns\n", to_milliseconds(stale_time), stale_scanned,
+		       patterns.size());
+
+		const auto stale_dropped = stale[0].count() == cold[0].count() - 1;
+		const auto matches = same_results(cold, warm);
+
+		printf("warm results %s cold results, stale match %s\n", matches ? "match" : "DIFFER from",
+		       stale_dropped ? "dropped" : "KEPT");
+
+		utils::io::remove_file(options.file);
+		return matches && warm_scanned == 0 && stale_scanned == 1 && stale_dropped;
+	}
+}
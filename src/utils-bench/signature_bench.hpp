@@ -0,0 +1,28 @@
+#pragma once
+
+namespace bench
+{
+	struct signature_bench_options
+	{
+		size_t image_size = 64 * 1024 * 1024;
+		size_t patterns = 500;
+
+		// How many patterns are also scanned one at a time for comparison
+		size_t baseline = 16;
+	};
+
+	// Scans a synthetic code image for many patterns in one batch, checks the
+	// results against single pattern scans and prints both timings.
+	bool run_signature_bench(const signature_bench_options& options);
+
+	struct signature_cache_bench_options
+	{
+		std::string file = "signature_bench.cache";
+		size_t image_size = 64 * 1024 * 1024;
+		size_t patterns = 500;
+	};
+
+	// Times a cold scan that fills the cache, a warm run served from it and
+	// a run where the image changed after hashing and validation has to catch it.
+	bool run_signature_cache_bench(const signature_cache_bench_options& options);
+}
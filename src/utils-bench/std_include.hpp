@@ -0,0 +1,22 @@
+#pragma once
+
+#include <map>
+#include <set>
+#include <array>
+#include <atomic>
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <utility>
+#include <tuple>
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <random>
+#include <string>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+
+using namespace std::literals;
@@ -0,0 +1,33 @@
+-- Times Lua to GSC calls of cheap builtins.
+-- Copy this folder to s1x/scripts/ and load a map on a dedicated server, results go to the console.
+
+local iterations = 1000000
+
+local function measure(name, callback)
+	local start = os.clock()
+
+	for _ = 1, iterations do
+		callback()
+	end
+
+	local elapsed = os.clock() - start
+	print(string.format("%-36s %8.1f ms %8.1f ns/call", name, elapsed * 1000, elapsed * 1e9 / iterations))
+end
+
+print(string.format("call_bench: %d iterations", iterations))
+
+measure("game:abs(-1)", function()
+	game:abs(-1)
+end)
+
+measure("game:max(1, 2.5)", function()
+	game:max(1, 2.5)
+end)
+
+measure("game:call(\"abs\", -1)", function()
+	game:call("abs", -1)
+end)
+
+measure("game:getdvarint(\"sv_maxclients\")", function()
+	game:getdvarint("sv_maxclients")
+end)